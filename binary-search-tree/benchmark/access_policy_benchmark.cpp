@@ -0,0 +1,169 @@
+#include <data-structures/binary-search-tree/bst_node.hpp>
+#include <data-structures/binary-search-tree/bt_access_policies.hpp>
+#include <data-structures/binary-search-tree/bt_update_strategies.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+using KeyType = std::int64_t;
+using ValueType = std::int64_t;
+using UpdateStrategy = RejectUpdates<KeyType, ValueType>;
+
+constexpr std::size_t kLookups = 1 << 16;
+
+std::vector<KeyType> ShuffledKeys(std::int64_t size)
+{
+    std::vector<KeyType> keys(size);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+    return keys;
+}
+
+template <typename TAccessPolicy>
+auto MakeTree(const std::vector<KeyType>& keys)
+{
+    auto root = MakeBSTNode<UpdateStrategy, TAccessPolicy>(keys.front(), keys.front());
+    for (auto it = std::next(keys.begin()); it != keys.end(); ++it) { root->Insert(*it, *it); }
+    return root;
+}
+
+/**
+ * Lookups of keys whose popularity follows Zipf's law with exponent 0.99. The popular keys are
+ * scattered over the key space.
+ */
+std::vector<KeyType> ZipfianTrace(const std::vector<KeyType>& keys)
+{
+    std::vector<double> weights(keys.size());
+    for (std::size_t rank = 0; rank < keys.size(); ++rank)
+    { weights[rank] = 1.0 / std::pow(static_cast<double>(rank + 1), 0.99); }
+
+    std::mt19937 random(7);
+    std::discrete_distribution<std::size_t> distribution(weights.begin(), weights.end());
+    std::vector<KeyType> trace(kLookups);
+    for (auto& key : trace) { key = keys[distribution(random)]; }
+    return trace;
+}
+
+template <typename TAccessPolicy>
+void BM_UniformLookup(benchmark::State& state)
+{
+    const auto keys = ShuffledKeys(state.range(0));
+    const auto root = MakeTree<TAccessPolicy>(keys);
+
+    std::mt19937 random(7);
+    std::uniform_int_distribution<std::size_t> distribution(0, keys.size() - 1);
+    std::vector<KeyType> trace(kLookups);
+    for (auto& key : trace) { key = keys[distribution(random)]; }
+
+    for (auto _ : state)
+    {
+        for (const auto key : trace) { benchmark::DoNotOptimize(root->Find(key)); }
+    }
+    state.SetItemsProcessed(state.iterations() * trace.size());
+}
+
+template <typename TAccessPolicy>
+void BM_ZipfianLookup(benchmark::State& state)
+{
+    const auto keys = ShuffledKeys(state.range(0));
+    const auto root = MakeTree<TAccessPolicy>(keys);
+    const auto trace = ZipfianTrace(keys);
+
+    for (auto _ : state)
+    {
+        for (const auto key : trace) { benchmark::DoNotOptimize(root->Find(key)); }
+    }
+    state.SetItemsProcessed(state.iterations() * trace.size());
+}
+
+/**
+ * Logging workload: every insertion of a new key is followed by lookups of keys whose age, counted
+ * in insertions, is geometrically distributed with mean 20. Keys are inserted either in random or
+ * in increasing order, as timestamps are.
+ */
+template <typename TAccessPolicy, bool increasing_keys>
+void BM_RecencyBiasedLookup(benchmark::State& state)
+{
+    constexpr std::size_t kLookupsPerInsert = 4;
+
+    auto keys = ShuffledKeys(state.range(0));
+    if (increasing_keys)
+    {
+        std::sort(keys.begin(), keys.end());
+    }
+    const auto initial = keys.size() / 2;
+
+    std::mt19937 random(7);
+    std::geometric_distribution<std::size_t> age(0.05);
+    std::vector<KeyType> trace;
+    for (auto inserted = initial; inserted < keys.size(); ++inserted)
+    {
+        for (std::size_t lookup = 0; lookup < kLookupsPerInsert; ++lookup)
+        { trace.push_back(keys[inserted - 1 - std::min(age(random), inserted - 1)]); }
+    }
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto root = MakeTree<TAccessPolicy>({keys.begin(), keys.begin() + initial});
+        state.ResumeTiming();
+
+        auto lookup = trace.begin();
+        for (auto inserted = initial; inserted < keys.size(); ++inserted)
+        {
+            root->Insert(keys[inserted], keys[inserted]);
+            for (std::size_t count = 0; count < kLookupsPerInsert; ++count, ++lookup)
+            { benchmark::DoNotOptimize(root->Find(*lookup)); }
+        }
+
+        state.PauseTiming();
+        root.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * trace.size());
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_UniformLookup, StaticAccess)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_UniformLookup, SplayOnAccess)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_UniformLookup, SemiSplayOnAccess)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_ZipfianLookup, StaticAccess)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_ZipfianLookup, SplayOnAccess)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_ZipfianLookup, SemiSplayOnAccess)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_RecencyBiasedLookup, StaticAccess, false)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 16)
+    ->Iterations(10);
+BENCHMARK_TEMPLATE(BM_RecencyBiasedLookup, SplayOnAccess, false)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 16)
+    ->Iterations(10);
+BENCHMARK_TEMPLATE(BM_RecencyBiasedLookup, SemiSplayOnAccess, false)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 16)
+    ->Iterations(10);
+BENCHMARK_TEMPLATE(BM_RecencyBiasedLookup, StaticAccess, true)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 14)
+    ->Iterations(10);
+BENCHMARK_TEMPLATE(BM_RecencyBiasedLookup, SplayOnAccess, true)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 14)
+    ->Iterations(10);
+BENCHMARK_TEMPLATE(BM_RecencyBiasedLookup, SemiSplayOnAccess, true)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 14)
+    ->Iterations(10);
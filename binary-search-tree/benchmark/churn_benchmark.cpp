@@ -0,0 +1,97 @@
+#include <data-structures/binary-search-tree/bst_node.hpp>
+#include <data-structures/binary-search-tree/bt_update_strategies.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using KeyType = std::int64_t;
+using ValueType = std::int64_t;
+using UpdateStrategy = RejectUpdates<KeyType, ValueType>;
+
+constexpr std::size_t kOperations = 1 << 21;
+
+/**
+ * Height of the subtree rooted at node, computed without recursion.
+ */
+template <typename TNodePtr>
+std::size_t Height(const TNodePtr& node)
+{
+    std::size_t height = 0;
+    std::vector<std::pair<const typename TNodePtr::element_type*, std::size_t>> pending{
+        {node.get(), 1}};
+    while (!pending.empty())
+    {
+        const auto [current, depth] = pending.back();
+        pending.pop_back();
+        height = std::max(height, depth);
+        for (const auto& child : {current->Left(), current->Right()})
+        {
+            if (child)
+            {
+                pending.emplace_back(child.get(), depth + 1);
+            }
+        }
+    }
+    return height;
+}
+}  // namespace
+
+/**
+ * Mixed workload over a tree that holds about range(0) keys: every operation either inserts a new
+ * random key or removes a random key present in the tree, with equal probability.
+ */
+static void BM_InsertRemoveChurn(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    std::mt19937_64 random(42);
+    std::uniform_int_distribution<KeyType> new_key(1, std::numeric_limits<KeyType>::max());
+
+    auto root = MakeBSTNode<UpdateStrategy>(KeyType{0}, KeyType{0});
+    std::vector<KeyType> keys;
+    while (keys.size() < size)
+    {
+        const auto key = new_key(random);
+        if (root->Insert(key, key).second)
+        {
+            keys.push_back(key);
+        }
+    }
+
+    for (auto _ : state)
+    {
+        for (std::size_t operation = 0; operation < kOperations; ++operation)
+        {
+            if (random() % 2 == 0 || keys.empty())
+            {
+                const auto key = new_key(random);
+                if (root->Insert(key, key).second)
+                {
+                    keys.push_back(key);
+                }
+                continue;
+            }
+
+            const auto index = random() % keys.size();
+            std::swap(keys[index], keys.back());
+            benchmark::DoNotOptimize(root->Remove(keys.back()));
+            keys.pop_back();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * kOperations);
+    state.counters["height"] = static_cast<double>(Height(root));
+}
+BENCHMARK(BM_InsertRemoveChurn)
+    ->RangeMultiplier(16)
+    ->Range(1 << 8, 1 << 16)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,88 @@
+#include <data-structures/binary-search-tree/bst_finger.hpp>
+#include <data-structures/binary-search-tree/bst_node.hpp>
+#include <data-structures/binary-search-tree/bt_update_strategies.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+using KeyType = std::int64_t;
+using ValueType = std::int64_t;
+using UpdateStrategy = RejectUpdates<KeyType, ValueType>;
+using Node = BSTNode<KeyType, ValueType, UpdateStrategy>;
+
+enum class Order
+{
+    kSorted,
+    kNearlySorted,
+    kRandom
+};
+
+/**
+ * Keys 0..size-1 in the given order. Nearly sorted keys are sorted keys with every key displaced by
+ * up to 8 positions.
+ */
+std::vector<KeyType> MakeKeys(std::int64_t size, Order order)
+{
+    std::vector<KeyType> keys(size);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::mt19937 random(42);
+    switch (order)
+    {
+        case Order::kSorted:
+            break;
+        case Order::kNearlySorted:
+            for (auto it = keys.begin(); std::distance(it, keys.end()) >= 8; it += 8)
+            { std::shuffle(it, it + 8, random); }
+            break;
+        case Order::kRandom:
+            std::shuffle(keys.begin(), keys.end(), random);
+            break;
+    }
+    return keys;
+}
+
+template <Order order>
+void BM_RootInsert(benchmark::State& state)
+{
+    const auto keys = MakeKeys(state.range(0), order);
+    for (auto _ : state)
+    {
+        auto root = MakeBSTNode<UpdateStrategy>(keys.front(), keys.front());
+        for (auto it = std::next(keys.begin()); it != keys.end(); ++it) { root->Insert(*it, *it); }
+        benchmark::DoNotOptimize(root);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <Order order>
+void BM_FingerInsert(benchmark::State& state)
+{
+    const auto keys = MakeKeys(state.range(0), order);
+    for (auto _ : state)
+    {
+        auto root = MakeBSTNode<UpdateStrategy>(keys.front(), keys.front());
+        BSTFinger<Node> finger(root);
+        for (auto it = std::next(keys.begin()); it != keys.end(); ++it) { finger.Insert(*it, *it); }
+        benchmark::DoNotOptimize(root);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_RootInsert, Order::kSorted)->RangeMultiplier(4)->Range(1 << 8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_FingerInsert, Order::kSorted)->RangeMultiplier(4)->Range(1 << 8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_RootInsert, Order::kNearlySorted)
+    ->RangeMultiplier(4)
+    ->Range(1 << 8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_FingerInsert, Order::kNearlySorted)
+    ->RangeMultiplier(4)
+    ->Range(1 << 8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_RootInsert, Order::kRandom)->RangeMultiplier(4)->Range(1 << 8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_FingerInsert, Order::kRandom)->RangeMultiplier(4)->Range(1 << 8, 1 << 14);
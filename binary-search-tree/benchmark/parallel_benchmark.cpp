@@ -0,0 +1,102 @@
+#include <data-structures/binary-search-tree/bst_node.hpp>
+#include <data-structures/binary-search-tree/bst_parallel.hpp>
+#include <data-structures/binary-search-tree/bt_update_strategies.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using KeyType = std::int64_t;
+using ValueType = std::int64_t;
+using UpdateStrategy = RejectUpdates<KeyType, ValueType>;
+using Node = BSTNode<KeyType, ValueType, UpdateStrategy>;
+
+constexpr KeyType kTreeSize = 1 << 20;
+
+std::vector<std::pair<KeyType, ValueType>> MakeSortedInput()
+{
+    std::vector<std::pair<KeyType, ValueType>> key_values;
+    key_values.reserve(kTreeSize);
+    for (KeyType key = 0; key < kTreeSize; ++key) { key_values.emplace_back(key, key); }
+    return key_values;
+}
+
+const Node::NodePtr& BalancedTree()
+{
+    static const auto tree = [] {
+        WorkStealingThreadPool pool;
+        return ParallelBuild<UpdateStrategy>(pool, MakeSortedInput());
+    }();
+    return tree;
+}
+
+void ThreadCounts(benchmark::internal::Benchmark* benchmark)
+{
+    const auto max_threads = std::max(1U, std::thread::hardware_concurrency());
+    for (auto threads = 1U; threads < max_threads; threads *= 2) { benchmark->Arg(threads); }
+    benchmark->Arg(max_threads);
+}
+}  // namespace
+
+static void BM_SequentialSum(benchmark::State& state)
+{
+    const auto& root = BalancedTree();
+    for (auto _ : state)
+    {
+        ValueType sum = 0;
+        for (auto it = root->Begin(); it != root->End(); ++it) { sum += (*it).Value(); }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * kTreeSize);
+}
+BENCHMARK(BM_SequentialSum)->Unit(benchmark::kMillisecond);
+
+static void BM_ParallelReduceSum(benchmark::State& state)
+{
+    const auto& root = BalancedTree();
+    WorkStealingThreadPool pool(state.range(0));
+    for (auto _ : state)
+    {
+        const auto sum = ParallelReduce(
+            pool,
+            *root,
+            ValueType{0},
+            [](const Node& node) { return node.Value(); },
+            [](ValueType lhs, ValueType rhs) { return lhs + rhs; });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * kTreeSize);
+}
+BENCHMARK(BM_ParallelReduceSum)->Apply(ThreadCounts)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_ParallelSortedChunks(benchmark::State& state)
+{
+    const auto& root = BalancedTree();
+    WorkStealingThreadPool pool(state.range(0));
+    for (auto _ : state) { benchmark::DoNotOptimize(ParallelSortedChunks(pool, *root)); }
+    state.SetItemsProcessed(state.iterations() * kTreeSize);
+}
+BENCHMARK(BM_ParallelSortedChunks)
+    ->Apply(ThreadCounts)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+static void BM_ParallelBuild(benchmark::State& state)
+{
+    WorkStealingThreadPool pool(state.range(0));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto input = MakeSortedInput();
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(ParallelBuild<UpdateStrategy>(pool, std::move(input)));
+    }
+    state.SetItemsProcessed(state.iterations() * kTreeSize);
+}
+BENCHMARK(BM_ParallelBuild)->Apply(ThreadCounts)->Unit(benchmark::kMillisecond)->UseRealTime();
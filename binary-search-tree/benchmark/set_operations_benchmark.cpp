@@ -0,0 +1,145 @@
+#include <data-structures/binary-search-tree/bst_node.hpp>
+#include <data-structures/binary-search-tree/bst_set_operations.hpp>
+#include <data-structures/binary-search-tree/bt_update_strategies.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+using KeyType = std::int64_t;
+using ValueType = std::int64_t;
+using UpdateStrategy = AcceptUpdates<KeyType, ValueType>;
+using Node = BSTNode<KeyType, ValueType, UpdateStrategy>;
+
+constexpr KeyType kLargeTreeSize = 1 << 16;
+
+/**
+ * Builds a tree of size keys spread evenly over [0, 2 * kLargeTreeSize), inserted in random order.
+ */
+Node::NodePtr MakeRandomTree(KeyType size, std::uint32_t seed)
+{
+    std::vector<KeyType> keys;
+    const auto stride = 2 * kLargeTreeSize / size;
+    for (KeyType key = seed % stride; key < 2 * kLargeTreeSize; key += stride)
+    { keys.push_back(key); }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(seed));
+
+    auto root = MakeBSTNode<UpdateStrategy>(keys.front(), keys.front());
+    for (auto it = std::next(keys.begin()); it != keys.end(); ++it) { root->Insert(*it, *it); }
+    return root;
+}
+}  // namespace
+
+static void BM_InsertLoopUnion(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto lhs = MakeRandomTree(kLargeTreeSize, 1);
+        auto rhs = MakeRandomTree(state.range(0), 2);
+        state.ResumeTiming();
+
+        for (auto it = rhs->Begin(); it != rhs->End(); ++it)
+        { lhs->Insert((*it).Key(), (*it).Value()); }
+        benchmark::DoNotOptimize(lhs);
+
+        state.PauseTiming();
+        lhs.reset();
+        rhs.reset();
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_InsertLoopUnion)->RangeMultiplier(16)->Range(16, kLargeTreeSize)->Iterations(10);
+
+static void BM_JoinBasedUnion(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto lhs = MakeRandomTree(kLargeTreeSize, 1);
+        auto rhs = MakeRandomTree(state.range(0), 2);
+        state.ResumeTiming();
+
+        auto united = Union(std::move(lhs), std::move(rhs));
+        benchmark::DoNotOptimize(united);
+
+        state.PauseTiming();
+        united.reset();
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_JoinBasedUnion)->RangeMultiplier(16)->Range(16, kLargeTreeSize)->Iterations(10);
+
+static void BM_RemoveLoopRangeErase(benchmark::State& state)
+{
+    const KeyType lo = kLargeTreeSize / 2;
+    const KeyType hi = lo + state.range(0);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto tree = MakeRandomTree(kLargeTreeSize, 1);
+        state.ResumeTiming();
+
+        for (auto key = lo; key < hi; ++key) { tree->Remove(key); }
+        benchmark::DoNotOptimize(tree);
+
+        state.PauseTiming();
+        tree.reset();
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_RemoveLoopRangeErase)->RangeMultiplier(16)->Range(16, 4096)->Iterations(10);
+
+static void BM_SplitJoinRangeErase(benchmark::State& state)
+{
+    const KeyType lo = kLargeTreeSize / 2;
+    const KeyType hi = lo + state.range(0);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto tree = MakeRandomTree(kLargeTreeSize, 1);
+        state.ResumeTiming();
+
+        auto lower = Split(std::move(tree), lo);
+        auto upper = Split(std::move(lower.greater), hi);
+        auto erased = std::move(upper.less);
+        if (upper.equal)
+        {
+            upper.equal->Connect(Direction::kRight, std::move(upper.greater));
+            upper.greater = std::move(upper.equal);
+        }
+        tree = Join(std::move(lower.less), std::move(upper.greater));
+        benchmark::DoNotOptimize(tree);
+
+        state.PauseTiming();
+        tree.reset();
+        erased.reset();
+        lower = {};
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_SplitJoinRangeErase)->RangeMultiplier(16)->Range(16, 4096)->Iterations(10);
+
+static void BM_RemoveRangeErase(benchmark::State& state)
+{
+    const KeyType lo = kLargeTreeSize / 2;
+    const KeyType hi = lo + state.range(0);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto tree = MakeRandomTree(kLargeTreeSize, 1);
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(tree->RemoveRange(lo, hi));
+
+        state.PauseTiming();
+        tree.reset();
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_RemoveRangeErase)->RangeMultiplier(16)->Range(16, 4096)->Iterations(10);
@@ -0,0 +1,243 @@
+#ifndef BINARY_SEARCH_TREE_BST_FINGER_HPP
+#define BINARY_SEARCH_TREE_BST_FINGER_HPP
+
+#include "bst_node.hpp"
+#include "bst_set_operations.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/**
+ * Finger into a binary search tree, pointing to the node of the last insertion made through it.
+ *
+ * Insertion through a finger starts from the finger instead of the root: it climbs up only as far
+ * as the first ancestor whose subtree can hold the new key, and descends from there. Inserting keys
+ * close to the previously inserted one thus takes few comparisons, and appending keys in increasing
+ * order takes a constant number of comparisons per key.
+ *
+ * Appending keys in order builds a chain of right children, which makes searches from the root take
+ * linear time. Calling Rebalance after every insertion keeps the tree logarithmic in height the way
+ * a scapegoat tree does, for an amortized O(log n) cost per insertion.
+ *
+ * @note Insertions that bypass the finger keep it valid, but removals from the tree invalidate it.
+ * So does any access to a tree with a self-adjusting access policy, which moves keys between nodes,
+ * and rebalancing through another finger.
+ *
+ * @tparam TNode node type of the tree
+ */
+template <typename TNode>
+class BSTFinger
+{
+public:
+    using NodePtr = typename TNode::NodePtr;
+    using KeyType = typename TNode::KeyType;
+    using ValueType = typename TNode::ValueType;
+
+    /**
+     * Creates a finger pointing to the root of the tree.
+     * @param root Root of the tree.
+     */
+    explicit BSTFinger(NodePtr root)
+    {
+        Reset(std::move(root));
+    }
+
+    /**
+     * Points the finger to the root of the tree.
+     * @param root Root of the tree, or nullptr to leave the finger empty.
+     */
+    void Reset(NodePtr root)
+    {
+        path_.clear();
+        if (root)
+        {
+            path_.push_back({std::move(root), kUnbounded, kUnbounded});
+        }
+    }
+
+    /**
+     * @return The node the finger points to, or nullptr if the finger is empty.
+     */
+    const NodePtr& Node() const
+    {
+        static const NodePtr kNone;
+        return path_.empty() ? kNone : path_.back().node;
+    }
+
+    /**
+     * Inserts new_node into the tree, starting the search from the finger, and moves the finger
+     * to the inserted node. Semantics are those of BSTNode::Insert.
+     *
+     * @param new_node Node to insert.
+     * @return a pair consisting of a pointer and a boolean, as returned by BSTNode::Insert.
+     */
+    std::pair<NodePtr, bool> Insert(NodePtr new_node);
+
+    /**
+     * Inserts a new node with the specified key and value, starting the search from the finger.
+     * Semantics are those of BSTNode::Insert.
+     *
+     * @param key Key of the new node.
+     * @param value Value of the new node.
+     * @return a pair consisting of a pointer and a boolean, as returned by BSTNode::Insert.
+     */
+    std::pair<NodePtr, bool> Insert(KeyType key, ValueType value);
+
+    /**
+     * Rebuilds the subtree of an ancestor of the finger if the finger is deeper than log_{3/2} of
+     * the tree size. The ancestor is the lowest one with a child holding more than 2/3 of its
+     * nodes, so that the rebuilt subtree is large enough to pay for the rebuild in the long run.
+     * The finger points to the root afterwards.
+     *
+     * @param size Number of nodes in the tree.
+     * @return Root of the tree, which changes if the whole tree is rebuilt.
+     */
+    NodePtr Rebalance(std::size_t size);
+
+private:
+    static constexpr std::size_t kUnbounded = std::numeric_limits<std::size_t>::max();
+
+    struct Level
+    {
+        NodePtr node;
+        /// Index in path_ of the nearest ancestor that bounds the subtree of node from below.
+        std::size_t lower;
+        /// Index in path_ of the nearest ancestor that bounds the subtree of node from above.
+        std::size_t upper;
+    };
+
+    bool Bounds(const Level& level, const KeyType& key) const
+    {
+        return (level.lower == kUnbounded || path_[level.lower].node->Key() < key)
+               && (level.upper == kUnbounded || key < path_[level.upper].node->Key());
+    }
+
+    std::size_t CountNodes(const NodePtr& root)
+    {
+        std::size_t count = 0;
+        pending_.clear();
+        if (root)
+        {
+            pending_.push_back(root.get());
+        }
+        while (!pending_.empty())
+        {
+            const auto* node = pending_.back();
+            pending_.pop_back();
+            ++count;
+            if (node->Left())
+            {
+                pending_.push_back(node->Left().get());
+            }
+            if (node->Right())
+            {
+                pending_.push_back(node->Right().get());
+            }
+        }
+        return count;
+    }
+
+    /// Path from the root to the node the finger points to.
+    std::vector<Level> path_;
+    /// Nodes left to visit by CountNodes, kept to reuse the allocation.
+    std::vector<const TNode*> pending_;
+};
+
+template <typename TNode>
+std::pair<typename BSTFinger<TNode>::NodePtr, bool> BSTFinger<TNode>::Insert(NodePtr new_node)
+{
+    if (!new_node || path_.empty())
+    {
+        return {nullptr, false};
+    }
+
+    const auto& key = new_node->Key();
+    // The root bounds every key, so the path never becomes empty.
+    while (path_.size() > 1 && !Bounds(path_.back(), key)) { path_.pop_back(); }
+
+    while (true)
+    {
+        const auto index = path_.size() - 1;
+        const auto node = path_.back().node;
+        const auto& node_key = node->Key();
+        if (node_key == key)
+        {
+            return node->Insert(std::move(new_node));
+        }
+
+        const auto direction = key < node_key ? Direction::kLeft : Direction::kRight;
+        const auto& next = direction == Direction::kLeft ? node->Left() : node->Right();
+        if (!next)
+        {
+            node->Connect(direction, new_node);
+        }
+
+        const auto& level = path_.back();
+        path_.push_back(direction == Direction::kLeft ? Level{next, level.lower, index}
+                                                      : Level{next, index, level.upper});
+        if (path_.back().node == new_node)
+        {
+            return {std::move(new_node), true};
+        }
+    }
+}
+
+template <typename TNode>
+std::pair<typename BSTFinger<TNode>::NodePtr, bool> BSTFinger<TNode>::Insert(KeyType key,
+                                                                              ValueType value)
+{
+    return Insert(std::make_shared<TNode>(std::move(key), std::move(value)));
+}
+
+template <typename TNode>
+typename BSTFinger<TNode>::NodePtr BSTFinger<TNode>::Rebalance(std::size_t size)
+{
+    if (path_.empty())
+    {
+        return nullptr;
+    }
+    const auto depth = static_cast<double>(path_.size() - 1);
+    if (depth <= std::log(static_cast<double>(size)) / std::log(1.5))
+    {
+        return path_.front().node;
+    }
+
+    // Climb towards the root, counting the nodes of the subtrees on the way, until a node is found
+    // whose child on the path holds more than 2/3 of its nodes. Such a node exists, since a tree
+    // without one is no deeper than log_{3/2} of its size.
+    auto index = path_.size() - 1;
+    auto child_size = CountNodes(path_[index].node);
+    for (; index > 0; --index)
+    {
+        const auto& parent = path_[index - 1].node;
+        const auto& child = path_[index].node;
+        const auto& sibling = parent->Left() == child ? parent->Right() : parent->Left();
+        const auto parent_size = child_size + 1 + CountNodes(sibling);
+        if (3 * child_size > 2 * parent_size)
+        {
+            break;
+        }
+        child_size = parent_size;
+    }
+    const auto scapegoat = index == 0 ? 0 : index - 1;
+
+    auto root = path_.front().node;
+    const auto& subtree = path_[scapegoat].node;
+    if (scapegoat == 0)
+    {
+        root = Balance(subtree);
+    }
+    else
+    {
+        const auto& parent = path_[scapegoat - 1].node;
+        const auto direction = parent->Left() == subtree ? Direction::kLeft : Direction::kRight;
+        parent->Connect(direction, Balance(subtree));
+    }
+    Reset(root);
+    return root;
+}
+
+#endif  // BINARY_SEARCH_TREE_BST_FINGER_HPP
@@ -6,12 +6,18 @@
 #define BINARY_SEARCH_TREE_BST_NODE_HPP
 
 #include <data-structures/concepts/bt_concepts.hpp>
+#include <data-structures/instrumentation/stats.hpp>
 
+#include "bst_node_fwd.hpp"
+#include "bst_stats.hpp"
 #include "bt_iterator.hpp"
 
 #include <concepts>
+#include <cstddef>
 #include <memory>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 /**
  * Direction of a descendant of a binary tree node.
@@ -27,18 +33,32 @@ enum class Direction : bool
  *
  * @tparam TKey key type
  * @tparam TValue value type
+ * @tparam TAccessPolicy policy that restructures the tree on Find and Insert, see
+ * bt_access_policies.hpp. The default StaticAccess leaves the shape of the tree untouched.
  */
-template <std::totally_ordered TKey, typename TValue, typename TUpdateStrategy>
-class BSTNode : public std::enable_shared_from_this<BSTNode<TKey, TValue, TUpdateStrategy>>
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+class BSTNode
+    : public std::enable_shared_from_this<BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>>
 {
 public:
-    using NodeType = BSTNode<TKey, TValue, TUpdateStrategy>;
+    using KeyType = TKey;
+    using ValueType = TValue;
+    using NodeType = BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>;
     using NodePtr = std::shared_ptr<NodeType>;
     using ConstNodePtr = std::shared_ptr<const NodeType>;
-    using ConstIterator = BinaryTreeConstIterator<TKey, TValue, TUpdateStrategy>;
+    using ConstIterator = BinaryTreeConstIterator<TKey, TValue, TUpdateStrategy, TAccessPolicy>;
 
     BSTNode(TKey key, TValue value) : key_(key), value_(value) {}
 
+    /**
+     * Destroys the descendants owned solely by this node iteratively, so that destroying
+     * arbitrarily deep trees does not exhaust the stack.
+     */
+    ~BSTNode();
+
     /**
      * Inserts new_node to the appropriate descendant leaf,
      * if the tree does not already contain a node with the same key.
@@ -50,6 +70,8 @@ public:
      * key.
      *  - Nullptr if new_node is nullptr.
      *  The boolean is true if the new node was successfully inserted, false otherwise.
+     * @note With a self-adjusting access policy, the pointer points to the node that holds the
+     * inserted or the conflicting key after the tree has been restructured.
      */
     std::pair<NodePtr, bool> Insert(
         NodePtr new_node) requires CallableWithUpdateSignature<TUpdateStrategy, NodeType>;
@@ -75,24 +97,51 @@ public:
      * @param key Key to search for.
      * @return NodePtr pointing to the requested node, or nullptr if the node with the requested key
      * was not found.
+     * @note With a self-adjusting access policy, the search restructures the tree, moving keys
+     * between nodes. Pointers to nodes other than the returned one may then hold different keys.
      */
     NodePtr Find(TKey key);
 
+    /**
+     * Searches for the first node, in key order, whose key is not less than the given key.
+     *
+     * @param key Key to search for.
+     * @return ConstIterator pointing to the found node, or End() if all keys are less than key.
+     */
+    ConstIterator LowerBound(TKey key) const;
+
     /**
      * Searches for the node with the given key among the descendants of this node
      * and removes it from the tree if found.
      *
      * @param key Key for which the node is to be removed.
      * @return Pointer to the removed node.
+     * @note Takes time proportional to the height of the tree. A removed node with two descendants
+     * is replaced by its in-order successor, and the rest of the tree keeps its shape.
      */
     NodePtr Remove(TKey key);
 
-    TKey Key() const
+    /**
+     * Removes all the nodes with keys in the range [lo, hi) from the tree.
+     *
+     * Takes time proportional to the height of the tree plus the number of removed nodes. Subtrees
+     * that lie entirely within the range are dropped without being visited one node at a time,
+     * apart from counting them.
+     *
+     * @param lo Lowest key to remove.
+     * @param hi Key above the highest key to remove.
+     * @return Number of removed nodes.
+     * @note As with Remove, this node itself stays in place. If the range covers every key of the
+     * tree, this node keeps its key, which is not counted as removed.
+     */
+    std::size_t RemoveRange(TKey lo, TKey hi);
+
+    const TKey& Key() const
     {
         return key_;
     }
 
-    TValue Value() const
+    const TValue& Value() const
     {
         return value_;
     }
@@ -106,6 +155,16 @@ public:
      */
     NodePtr Disconnect(Direction direction);
 
+    /**
+     * Connects node as the direct descendant in the given direction.
+     *
+     * @param direction Direction
+     * @param node Node to connect. The keys of the node and its descendants must belong to the
+     * given direction relative to the key of this node.
+     * @return Pointer to the previously connected descendant, or nullptr if there was none.
+     */
+    NodePtr Connect(Direction direction, NodePtr node);
+
     const NodePtr& Left() const
     {
         return left_;
@@ -118,7 +177,7 @@ public:
 
     /**
      * Removes the direct descendant node in the given direction and reconnects any descendants of
-     * the removed node.
+     * the removed node in its place, splicing in its in-order successor if it has two descendants.
      *
      * @param direction Indicates whether the left or the right direct descendant is to be removed.
      * @return Pointer to the removed node, or nullptr if the descendant is not found
@@ -129,7 +188,29 @@ public:
 
     ConstIterator End() const;
 
+    /**
+     * @return Statistics of the operations on all trees of this type, across all threads. Only
+     * collected when kStatsEnabled is true, and all zero otherwise.
+     */
+    static BSTStats Stats();
+
+    static void ResetStats();
+
 private:
+    struct StatsCounters
+    {
+        OperationCounter<> insert;
+        OperationCounter<> find;
+        OperationCounter<> remove;
+        OperationCounter<> iteration;
+    };
+
+    static StatsCounters& Counters()
+    {
+        static StatsCounters counters;
+        return counters;
+    }
+
     /**
      * Searches for the Node that is parent of the Node with the given key.
      *
@@ -139,7 +220,58 @@ private:
      * was not found,
      *  - Direction of the descendant with the given key.
      */
-    std::pair<NodePtr, Direction> FindParent(TKey key);
+    std::pair<NodePtr, Direction> FindParent(TKey key, ScopedOperation<>& operation);
+
+    /**
+     * Detaches the node with the minimum key from the subtree at link.
+     *
+     * @param link Link to a non-empty subtree, updated if its root is the minimum.
+     * @return The detached node. Its right descendant is reconnected in its place.
+     */
+    static NodePtr DetachMin(NodePtr& link);
+
+    /**
+     * Disconnects the descendants of node and combines them into a single subtree.
+     *
+     * @return The subtree to connect in place of node.
+     */
+    static NodePtr Splice(NodeType& node);
+
+    /**
+     * Removes the nodes with keys not less than bound from the subtree at link.
+     * @return Number of removed nodes.
+     */
+    static std::size_t RemoveNotLess(NodePtr& link, const TKey& bound);
+
+    /**
+     * Removes the nodes with keys less than bound from the subtree at link.
+     * @return Number of removed nodes.
+     */
+    static std::size_t RemoveLess(NodePtr& link, const TKey& bound);
+
+    static std::size_t Size(const NodeType& node);
+
+    /**
+     * Rotates the direct descendant in the given direction into the position of this node.
+     * Keys and values are exchanged instead of links, so that this node keeps its position in the
+     * tree, and pointers to the root remain valid.
+     *
+     * @param direction Direction of the descendant to rotate. The descendant must exist.
+     */
+    void Rotate(Direction direction);
+
+    static constexpr bool kSelfAdjusting = !std::is_same_v<TAccessPolicy, StaticAccess>;
+
+    /**
+     * @return Empty buffer for the path of an access, reused by the accesses on the calling thread
+     * so that self-adjusting searches do not allocate.
+     */
+    static std::vector<NodeType*>& AccessPath()
+    {
+        static thread_local std::vector<NodeType*> path;
+        path.clear();
+        return path;
+    }
 
     TKey key_;
     TValue value_;
@@ -148,17 +280,51 @@ private:
     NodePtr right_;
 
     friend TUpdateStrategy;
+    friend TAccessPolicy;
 };
 
-template <typename TUpdateStrategy, std::totally_ordered TKey, typename TValue>
-typename BSTNode<TKey, TValue, TUpdateStrategy>::NodePtr MakeBSTNode(TKey key, TValue value)
+template <typename TUpdateStrategy,
+          typename TAccessPolicy = StaticAccess,
+          std::totally_ordered TKey,
+          typename TValue>
+typename BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::NodePtr MakeBSTNode(TKey key,
+                                                                                   TValue value)
 {
-    return std::make_shared<BSTNode<TKey, TValue, TUpdateStrategy>>(key, value);
+    return std::make_shared<BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>>(key, value);
+}
+
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::~BSTNode()
+{
+    std::vector<NodePtr> pending;
+    const auto take_sole_owned = [&pending](NodePtr& node) {
+        if (node && node.use_count() == 1)
+        {
+            pending.push_back(std::move(node));
+        }
+    };
+
+    take_sole_owned(left_);
+    take_sole_owned(right_);
+    while (!pending.empty())
+    {
+        // Each node is destroyed only after its descendants have been taken over.
+        auto node = std::move(pending.back());
+        pending.pop_back();
+        take_sole_owned(node->left_);
+        take_sole_owned(node->right_);
+    }
 }
 
-template <std::totally_ordered TKey, typename TValue, typename TUpdateStrategy>
-std::pair<typename BSTNode<TKey, TValue, TUpdateStrategy>::NodePtr, bool>
-BSTNode<TKey, TValue, TUpdateStrategy>::Insert(
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+std::pair<typename BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::NodePtr, bool>
+BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::Insert(
     NodePtr new_node) requires CallableWithUpdateSignature<TUpdateStrategy, NodeType>
 {
     if (!new_node)
@@ -166,112 +332,189 @@ BSTNode<TKey, TValue, TUpdateStrategy>::Insert(
         return {nullptr, false};
     }
 
-    if (new_node->Key() == key_)
+    ScopedOperation<> operation(Counters().insert);
+    const auto path = kSelfAdjusting ? &AccessPath() : nullptr;
+    std::pair<NodePtr, bool> result;
+    auto node = this;
+    while (true)
     {
-        return TUpdateStrategy()(*this, std::move(*new_node));
-    }
+        if constexpr (kSelfAdjusting)
+        {
+            path->push_back(node);
+        }
 
-    if (new_node->Key() < key_)
-    {
-        if (!left_)
+        operation.Compare();
+        if (new_node->Key() == node->key_)
         {
-            left_.swap(new_node);
-            return {left_, true};
+            result = TUpdateStrategy()(*node, std::move(*new_node));
+            break;
         }
-        return left_->Insert(std::move(new_node));
+
+        auto& next = new_node->Key() < node->key_ ? node->left_ : node->right_;
+        if (!next)
+        {
+            next.swap(new_node);
+            result = {next, true};
+            if constexpr (kSelfAdjusting)
+            {
+                path->push_back(next.get());
+            }
+            break;
+        }
+        node = next.get();
     }
 
-    if (!right_)
+    if constexpr (kSelfAdjusting)
     {
-        right_.swap(new_node);
-        return {right_, true};
+        result.first = TAccessPolicy()(*path)->shared_from_this();
     }
-    return right_->Insert(std::move(new_node));
+    return result;
 }
 
-template <std::totally_ordered TKey, typename TValue, typename TUpdateStrategy>
-std::pair<typename BSTNode<TKey, TValue, TUpdateStrategy>::NodePtr, bool>
-BSTNode<TKey, TValue, TUpdateStrategy>::Insert(
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+std::pair<typename BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::NodePtr, bool>
+BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::Insert(
     TKey key, TValue value) requires CallableWithUpdateSignature<TUpdateStrategy, NodeType>
 {
-    return Insert(MakeBSTNode<TUpdateStrategy, TKey, TValue>(key, value));
+    return Insert(std::make_shared<NodeType>(key, value));
 }
 
-template <std::totally_ordered TKey, typename TValue, typename TUpdateStrategy>
-typename BSTNode<TKey, TValue, TUpdateStrategy>::NodePtr
-BSTNode<TKey, TValue, TUpdateStrategy>::Find(TKey key)
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+typename BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::NodePtr
+BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::Find(TKey key)
 {
-    if (key == key_)
+    ScopedOperation<> operation(Counters().find);
+    const auto path = kSelfAdjusting ? &AccessPath() : nullptr;
+    auto node = this;
+    while (true)
     {
-        return this->shared_from_this();
+        if constexpr (kSelfAdjusting)
+        {
+            path->push_back(node);
+        }
+
+        operation.Compare();
+        if (key == node->key_)
+        {
+            break;
+        }
+
+        const auto& next = key < node->key_ ? node->left_ : node->right_;
+        if (!next)
+        {
+            // Adjusting on a miss too keeps the cost of unsuccessful searches amortized.
+            if constexpr (kSelfAdjusting)
+            {
+                TAccessPolicy()(*path);
+            }
+            return nullptr;
+        }
+        node = next.get();
     }
 
-    if (key > key_)
+    if constexpr (kSelfAdjusting)
     {
-        return right_ ? right_->Find(key) : nullptr;
+        node = TAccessPolicy()(*path);
     }
-
-    return left_ ? left_->Find(key) : nullptr;
+    return node->shared_from_this();
 }
 
-template <std::totally_ordered TKey, typename TValue, typename TUpdateStrategy>
-std::pair<typename BSTNode<TKey, TValue, TUpdateStrategy>::NodePtr, Direction>
-BSTNode<TKey, TValue, TUpdateStrategy>::FindParent(TKey key)
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+typename BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::ConstIterator
+BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::LowerBound(TKey key) const
 {
-    if (!left_ && !right_)
-    {
-        return {nullptr, Direction{}};
-    }
-    if (left_ && key < key_)
+    ScopedOperation<> operation(Counters().iteration);
+    // Nodes at which the search turned left are exactly the nodes the iterator has yet to visit.
+    std::stack<ConstNodePtr> parent_stack;
+    auto current = this->shared_from_this();
+    while (current)
     {
-        if (left_->Key() == key)
-        {
-            return {this->shared_from_this(), Direction::kLeft};
-        }
-        auto found_left = left_->FindParent(key);
-        if (found_left.first)
+        operation.Compare();
+        if (current->Key() < key)
         {
-            return found_left;
+            current = current->Right();
+            continue;
         }
+        parent_stack.push(current);
+        current = current->Left();
     }
-    if (right_ && key > key_)
+
+    if (parent_stack.empty())
     {
-        if (right_->Key() == key)
+        return End();
+    }
+    current = parent_stack.top();
+    parent_stack.pop();
+    return BSTNode::ConstIterator(std::move(parent_stack), std::move(current));
+}
+
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+std::pair<typename BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::NodePtr, Direction>
+BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::FindParent(TKey key,
+                                                                  ScopedOperation<>& operation)
+{
+    auto node = this;
+    while (true)
+    {
+        operation.Compare();
+        const auto direction = key < node->key_ ? Direction::kLeft : Direction::kRight;
+        const auto& next = direction == Direction::kLeft ? node->left_ : node->right_;
+        if (!next)
+        {
+            return {nullptr, Direction{}};
+        }
+        if (next->key_ == key)
         {
-            return {this->shared_from_this(), Direction::kRight};
+            return {node->shared_from_this(), direction};
         }
-        return right_->FindParent(key);
+        node = next.get();
     }
-    return {nullptr, Direction{}};
 }
 
-template <std::totally_ordered TKey, typename TValue, typename TUpdateStrategy>
-typename BSTNode<TKey, TValue, TUpdateStrategy>::NodePtr
-BSTNode<TKey, TValue, TUpdateStrategy>::Remove(TKey key)
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+typename BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::NodePtr
+BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::Remove(TKey key)
 {
+    ScopedOperation<> operation(Counters().remove);
+    operation.Compare();
     if (key == key_)
     {
-        auto removed_node = MakeBSTNode<TUpdateStrategy>(key_, value_);
-        if (left_)
+        if (!left_ && !right_)
         {
-            auto&& right = Disconnect(Direction::kRight);
-            key_ = left_->Key();
-            value_ = left_->Value();
-            right_ = left_->Right();
-            left_ = left_->Left();
-            Insert(std::move(right));
+            return std::make_shared<NodeType>(key_, value_);
         }
-        else if (right_)
+
+        auto removed_node = std::make_shared<NodeType>(std::move(key_), std::move(value_));
+        // The contents of the replacement move into this node, which has to stay in place.
+        auto replacement = left_ && right_
+                               ? DetachMin(right_)
+                               : Disconnect(left_ ? Direction::kLeft : Direction::kRight);
+        key_ = std::move(replacement->key_);
+        value_ = std::move(replacement->value_);
+        if (!left_ && !right_)
         {
-            key_ = right_->Key();
-            value_ = right_->Value();
-            left_ = right_->Left();
-            right_ = right_->Right();
+            left_ = std::move(replacement->left_);
+            right_ = std::move(replacement->right_);
         }
         return removed_node;
     }
 
-    const auto parent_and_direction = FindParent(key);
+    const auto parent_and_direction = FindParent(key, operation);
     if (!parent_and_direction.first)
     {
         return nullptr;
@@ -280,47 +523,262 @@ BSTNode<TKey, TValue, TUpdateStrategy>::Remove(TKey key)
     return parent_and_direction.first->RemoveNext(parent_and_direction.second);
 }
 
-template <std::totally_ordered TKey, typename TValue, typename TUpdateStrategy>
-typename BSTNode<TKey, TValue, TUpdateStrategy>::NodePtr
-BSTNode<TKey, TValue, TUpdateStrategy>::RemoveNext(Direction direction)
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+std::size_t BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::RemoveRange(TKey lo, TKey hi)
 {
-    // Removed node with its descendants
-    auto removed_node = Disconnect(direction);
-    if (!removed_node)
+    if (!(lo < hi))
     {
-        return nullptr;
+        return 0;
+    }
+
+    // All the keys in the range lie in the subtree of the first node on the search path that is in
+    // the range. Its left subtree keeps the keys below lo, and its right subtree those from hi on.
+    NodePtr* link = nullptr;
+    auto node = this;
+    while (node->key_ < lo || !(node->key_ < hi))
+    {
+        link = node->key_ < lo ? &node->right_ : &node->left_;
+        if (!*link)
+        {
+            return 0;
+        }
+        node = link->get();
+    }
+
+    auto removed = RemoveNotLess(node->left_, lo) + RemoveLess(node->right_, hi);
+    if (!link)
+    {
+        removed += left_ || right_ ? 1 : 0;
+        Remove(key_);
+        return removed;
+    }
+
+    auto removed_node = std::move(*link);
+    *link = Splice(*removed_node);
+    return removed + 1;
+}
+
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+typename BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::NodePtr
+BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::DetachMin(NodePtr& link)
+{
+    auto min_link = &link;
+    while ((*min_link)->left_) { min_link = &(*min_link)->left_; }
+
+    auto min = std::move(*min_link);
+    *min_link = std::move(min->right_);
+    return min;
+}
+
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+typename BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::NodePtr
+BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::Splice(NodeType& node)
+{
+    if (!node.left_ || !node.right_)
+    {
+        return std::move(node.left_ ? node.left_ : node.right_);
+    }
+
+    auto successor = DetachMin(node.right_);
+    successor->left_ = std::move(node.left_);
+    successor->right_ = std::move(node.right_);
+    return successor;
+}
+
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+std::size_t BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::RemoveNotLess(NodePtr& link,
+                                                                     const TKey& bound)
+{
+    std::size_t removed = 0;
+    auto current = &link;
+    while (*current)
+    {
+        if ((*current)->key_ < bound)
+        {
+            current = &(*current)->right_;
+            continue;
+        }
+        // The node goes together with its right subtree, while its left subtree takes its place.
+        auto removed_node = std::move(*current);
+        *current = std::move(removed_node->left_);
+        removed += Size(*removed_node);
+    }
+    return removed;
+}
+
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+std::size_t BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::RemoveLess(NodePtr& link,
+                                                                  const TKey& bound)
+{
+    std::size_t removed = 0;
+    auto current = &link;
+    while (*current)
+    {
+        if (!((*current)->key_ < bound))
+        {
+            current = &(*current)->left_;
+            continue;
+        }
+        auto removed_node = std::move(*current);
+        *current = std::move(removed_node->right_);
+        removed += Size(*removed_node);
+    }
+    return removed;
+}
+
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+std::size_t BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::Size(const NodeType& node)
+{
+    std::size_t size = 0;
+    std::vector<const NodeType*> pending{&node};
+    while (!pending.empty())
+    {
+        const auto current = pending.back();
+        pending.pop_back();
+        ++size;
+        if (current->left_)
+        {
+            pending.push_back(current->left_.get());
+        }
+        if (current->right_)
+        {
+            pending.push_back(current->right_.get());
+        }
     }
+    return size;
+}
 
-    Insert(removed_node->Disconnect(Direction::kLeft));
-    Insert(removed_node->Disconnect(Direction::kRight));
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+typename BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::NodePtr
+BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::RemoveNext(Direction direction)
+{
+    auto& link = direction == Direction::kLeft ? left_ : right_;
+    if (!link)
+    {
+        return nullptr;
+    }
 
+    auto removed_node = std::move(link);
+    link = Splice(*removed_node);
     return removed_node;
 }
 
-template <std::totally_ordered TKey, typename TValue, typename TUpdateStrategy>
-typename BSTNode<TKey, TValue, TUpdateStrategy>::NodePtr
-BSTNode<TKey, TValue, TUpdateStrategy>::Disconnect(Direction direction)
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+void BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::Rotate(Direction direction)
+{
+    // Rotating the left descendant C of this node P turns P(C(a, b), c) into C(a, P(b, c)), with
+    // the node objects of P and C trading places by exchanging their contents. Symmetrically for
+    // the right descendant.
+    const auto left = direction == Direction::kLeft;
+    auto& outer = left ? left_ : right_;
+    auto& inner = left ? right_ : left_;
+    auto child = std::move(outer);
+    auto& child_outer = left ? child->left_ : child->right_;
+    auto& child_inner = left ? child->right_ : child->left_;
+
+    std::swap(key_, child->key_);
+    std::swap(value_, child->value_);
+    outer = std::move(child_outer);
+    child_outer = std::move(child_inner);
+    child_inner = std::move(inner);
+    inner = std::move(child);
+}
+
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+typename BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::NodePtr
+BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::Disconnect(Direction direction)
 {
     NodePtr disconnected_node;
     std::swap(disconnected_node, (direction == Direction::kLeft ? left_ : right_));
     return disconnected_node;
 }
 
-template <std::totally_ordered TKey, typename TValue, typename TUpdateStrategy>
-typename BSTNode<TKey, TValue, TUpdateStrategy>::ConstIterator
-BSTNode<TKey, TValue, TUpdateStrategy>::Begin() const
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+typename BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::NodePtr
+BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::Connect(Direction direction, NodePtr node)
 {
+    std::swap(node, (direction == Direction::kLeft ? left_ : right_));
+    return node;
+}
+
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+typename BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::ConstIterator
+BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::Begin() const
+{
+    ScopedOperation<> operation(Counters().iteration);
     std::stack<ConstNodePtr> parent_stack;
     auto current = this->shared_from_this();
     ConstIterator::WindLeft(current, parent_stack);
     return BSTNode::ConstIterator(std::move(parent_stack), std::move(current));
 }
 
-template <std::totally_ordered TKey, typename TValue, typename TUpdateStrategy>
-typename BSTNode<TKey, TValue, TUpdateStrategy>::ConstIterator
-BSTNode<TKey, TValue, TUpdateStrategy>::End() const
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+typename BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::ConstIterator
+BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::End() const
 {
     return BSTNode::ConstIterator(std::stack<ConstNodePtr>{}, nullptr);
 }
 
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+BSTStats BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::Stats()
+{
+    auto& counters = Counters();
+    return {counters.insert.Stats(),
+            counters.find.Stats(),
+            counters.remove.Stats(),
+            counters.iteration.Stats()};
+}
+
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy>
+void BSTNode<TKey, TValue, TUpdateStrategy, TAccessPolicy>::ResetStats()
+{
+    auto& counters = Counters();
+    counters.insert.Reset();
+    counters.find.Reset();
+    counters.remove.Reset();
+    counters.iteration.Reset();
+}
+
 #endif  // BINARY_SEARCH_TREE_BST_NODE_HPP
@@ -0,0 +1,14 @@
+#ifndef BINARY_SEARCH_TREE_BST_NODE_FWD_HPP
+#define BINARY_SEARCH_TREE_BST_NODE_FWD_HPP
+
+#include <concepts>
+
+struct StaticAccess;
+
+template <std::totally_ordered TKey,
+          typename TValue,
+          typename TUpdateStrategy,
+          typename TAccessPolicy = StaticAccess>
+class BSTNode;
+
+#endif  // BINARY_SEARCH_TREE_BST_NODE_FWD_HPP
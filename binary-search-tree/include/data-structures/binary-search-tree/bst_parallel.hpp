@@ -0,0 +1,327 @@
+#ifndef BINARY_SEARCH_TREE_BST_PARALLEL_HPP
+#define BINARY_SEARCH_TREE_BST_PARALLEL_HPP
+
+#include <data-structures/concurrency/work_stealing_thread_pool.hpp>
+
+#include "bst_node.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
+// Parallel algorithms over binary search trees.
+//
+// The tree is split into pieces ordered by key: the nodes close to the root one by one, and the
+// subtrees below them whole. The subtrees are processed as separate tasks on a work stealing
+// thread pool. Since the split is by depth, the parallelism relies on the tree being reasonably
+// balanced, as the trees built by ParallelBuild are.
+
+namespace bst_parallel_detail
+{
+template <typename TNode>
+struct KeyRange
+{
+    std::optional<typename TNode::KeyType> lo;
+    std::optional<typename TNode::KeyType> hi;
+
+    bool Contains(const typename TNode::KeyType& key) const
+    {
+        return (!lo || !(key < *lo)) && (!hi || key < *hi);
+    }
+};
+
+template <typename TNode>
+struct Piece
+{
+    const TNode* node;
+    /// Whether the piece consists of the whole subtree of node, or just of node.
+    bool whole_subtree;
+};
+
+/**
+ * Number of levels of the tree whose nodes are split off one by one. Subtrees rooted below these
+ * levels become separate tasks, several per thread to leave room for stealing.
+ */
+inline std::size_t SplitDepth(const WorkStealingThreadPool& pool)
+{
+    return std::bit_width(pool.ThreadCount()) + 3;
+}
+
+template <typename TNode>
+void SplitInOrder(const TNode* node,
+                  const KeyRange<TNode>& range,
+                  std::size_t depth,
+                  std::vector<Piece<TNode>>& pieces)
+{
+    if (!node)
+    {
+        return;
+    }
+    if (depth == 0)
+    {
+        pieces.push_back({node, true});
+        return;
+    }
+
+    const auto key = node->Key();
+    if (!range.lo || *range.lo < key)
+    {
+        SplitInOrder(node->Left().get(), range, depth - 1, pieces);
+    }
+    if (range.Contains(key))
+    {
+        pieces.push_back({node, false});
+    }
+    if (!range.hi || key < *range.hi)
+    {
+        SplitInOrder(node->Right().get(), range, depth - 1, pieces);
+    }
+}
+
+template <typename TNode>
+std::vector<Piece<TNode>> SplitInOrder(const WorkStealingThreadPool& pool,
+                                       const TNode& root,
+                                       const KeyRange<TNode>& range)
+{
+    std::vector<Piece<TNode>> pieces;
+    SplitInOrder(&root, range, SplitDepth(pool), pieces);
+    return pieces;
+}
+
+/**
+ * Calls function for the nodes of the piece with keys in range, in key order.
+ */
+template <typename TNode, typename TFunction>
+void ForEachInPiece(const Piece<TNode>& piece, const KeyRange<TNode>& range, TFunction&& function)
+{
+    if (!piece.whole_subtree)
+    {
+        function(*piece.node);
+        return;
+    }
+
+    auto it = range.lo ? piece.node->LowerBound(*range.lo) : piece.node->Begin();
+    for (; it != piece.node->End() && (!range.hi || (*it).Key() < *range.hi); ++it)
+    { function(*it); }
+}
+
+template <typename TNode, typename TFunction>
+void ParallelForEach(WorkStealingThreadPool& pool,
+                     const TNode& root,
+                     const KeyRange<TNode>& range,
+                     TFunction& function)
+{
+    TaskGroup group(pool);
+    for (const auto& piece : SplitInOrder(pool, root, range))
+    {
+        if (piece.whole_subtree)
+        {
+            group.Run([&range, &function, piece] { ForEachInPiece(piece, range, function); });
+            continue;
+        }
+        ForEachInPiece(piece, range, function);
+    }
+    group.Wait();
+}
+
+template <typename TNode, typename TResult, typename TMap, typename TCombine>
+TResult ParallelReduce(WorkStealingThreadPool& pool,
+                       const TNode& root,
+                       const KeyRange<TNode>& range,
+                       TResult identity,
+                       TMap& map,
+                       TCombine& combine)
+{
+    const auto pieces = SplitInOrder(pool, root, range);
+    std::vector<TResult> results(pieces.size(), identity);
+
+    const auto reduce_piece = [&](std::size_t index) {
+        ForEachInPiece(pieces[index], range, [&](const TNode& node) {
+            results[index] = combine(std::move(results[index]), map(node));
+        });
+    };
+
+    TaskGroup group(pool);
+    for (std::size_t index = 0; index < pieces.size(); ++index)
+    {
+        if (pieces[index].whole_subtree)
+        {
+            group.Run([&reduce_piece, index] { reduce_piece(index); });
+            continue;
+        }
+        reduce_piece(index);
+    }
+    group.Wait();
+
+    auto result = std::move(identity);
+    for (auto& piece_result : results) { result = combine(std::move(result), std::move(piece_result)); }
+    return result;
+}
+
+template <typename TUpdateStrategy, typename TIterator>
+auto ParallelBuild(WorkStealingThreadPool& pool, TIterator begin, TIterator end, std::size_t depth)
+    -> decltype(MakeBSTNode<TUpdateStrategy>(std::move(begin->first), std::move(begin->second)))
+{
+    if (begin == end)
+    {
+        return nullptr;
+    }
+
+    const auto middle = std::next(begin, std::distance(begin, end) / 2);
+    auto node = MakeBSTNode<TUpdateStrategy>(std::move(middle->first), std::move(middle->second));
+
+    decltype(node) left;
+    decltype(node) right;
+    if (depth == 0)
+    {
+        left = ParallelBuild<TUpdateStrategy>(pool, begin, middle, depth);
+        right = ParallelBuild<TUpdateStrategy>(pool, std::next(middle), end, depth);
+    }
+    else
+    {
+        TaskGroup group(pool);
+        group.Run([&] { left = ParallelBuild<TUpdateStrategy>(pool, begin, middle, depth - 1); });
+        right = ParallelBuild<TUpdateStrategy>(pool, std::next(middle), end, depth - 1);
+        group.Wait();
+    }
+
+    node->Connect(Direction::kLeft, std::move(left));
+    node->Connect(Direction::kRight, std::move(right));
+    return node;
+}
+}  // namespace bst_parallel_detail
+
+/**
+ * Calls function for every node of the tree. The calls are made concurrently from the threads of
+ * the pool and the calling thread, in no particular order.
+ *
+ * @param pool Pool to run the traversal on.
+ * @param root Root of the tree.
+ * @param function Thread-safe function called with a const reference to each node.
+ */
+template <typename TNode, typename TFunction>
+void ParallelForEach(WorkStealingThreadPool& pool, const TNode& root, TFunction function)
+{
+    bst_parallel_detail::ParallelForEach(pool, root, bst_parallel_detail::KeyRange<TNode>{}, function);
+}
+
+/**
+ * Calls function for every node of the tree with the key in [lo, hi). The calls are made
+ * concurrently from the threads of the pool and the calling thread, in no particular order.
+ *
+ * @param pool Pool to run the traversal on.
+ * @param root Root of the tree.
+ * @param lo Lowest key to visit.
+ * @param hi Key above the highest key to visit.
+ * @param function Thread-safe function called with a const reference to each node.
+ */
+template <typename TNode, typename TFunction>
+void ParallelForEach(WorkStealingThreadPool& pool,
+                     const TNode& root,
+                     typename TNode::KeyType lo,
+                     typename TNode::KeyType hi,
+                     TFunction function)
+{
+    bst_parallel_detail::ParallelForEach(
+        pool, root, bst_parallel_detail::KeyRange<TNode>{std::move(lo), std::move(hi)}, function);
+}
+
+/**
+ * Maps every node of the tree to a result and combines the results in key order.
+ *
+ * @param pool Pool to run the reduction on.
+ * @param root Root of the tree.
+ * @param identity Identity element of combine.
+ * @param map Thread-safe function that maps a const reference to a node to TResult.
+ * @param combine Thread-safe associative function that combines two TResults into one.
+ * @return Combination of the results of all nodes, in key order.
+ */
+template <typename TNode, typename TResult, typename TMap, typename TCombine>
+TResult ParallelReduce(
+    WorkStealingThreadPool& pool, const TNode& root, TResult identity, TMap map, TCombine combine)
+{
+    return bst_parallel_detail::ParallelReduce(
+        pool, root, bst_parallel_detail::KeyRange<TNode>{}, std::move(identity), map, combine);
+}
+
+/**
+ * Maps every node of the tree with the key in [lo, hi) to a result and combines the results in key
+ * order.
+ *
+ * @param pool Pool to run the reduction on.
+ * @param root Root of the tree.
+ * @param lo Lowest key to visit.
+ * @param hi Key above the highest key to visit.
+ * @param identity Identity element of combine.
+ * @param map Thread-safe function that maps a const reference to a node to TResult.
+ * @param combine Thread-safe associative function that combines two TResults into one.
+ * @return Combination of the results of the visited nodes, in key order.
+ */
+template <typename TNode, typename TResult, typename TMap, typename TCombine>
+TResult ParallelReduce(WorkStealingThreadPool& pool,
+                       const TNode& root,
+                       typename TNode::KeyType lo,
+                       typename TNode::KeyType hi,
+                       TResult identity,
+                       TMap map,
+                       TCombine combine)
+{
+    return bst_parallel_detail::ParallelReduce(
+        pool,
+        root,
+        bst_parallel_detail::KeyRange<TNode>{std::move(lo), std::move(hi)},
+        std::move(identity),
+        map,
+        combine);
+}
+
+/**
+ * Copies the keys and values of the tree into sorted chunks, in parallel.
+ *
+ * @param pool Pool to run the traversal on.
+ * @param root Root of the tree.
+ * @return Non-empty chunks of key-value pairs. Each chunk is sorted by key, and all the keys in a
+ * chunk are less than the keys in the following chunks.
+ */
+template <typename TNode>
+std::vector<std::vector<std::pair<typename TNode::KeyType, typename TNode::ValueType>>>
+ParallelSortedChunks(WorkStealingThreadPool& pool, const TNode& root)
+{
+    const bst_parallel_detail::KeyRange<TNode> range;
+    const auto pieces = bst_parallel_detail::SplitInOrder(pool, root, range);
+    std::vector<std::vector<std::pair<typename TNode::KeyType, typename TNode::ValueType>>> chunks(
+        pieces.size());
+
+    TaskGroup group(pool);
+    for (std::size_t index = 0; index < pieces.size(); ++index)
+    {
+        group.Run([&, index] {
+            bst_parallel_detail::ForEachInPiece(pieces[index], range, [&](const TNode& node) {
+                chunks[index].emplace_back(node.Key(), node.Value());
+            });
+        });
+    }
+    group.Wait();
+
+    return chunks;
+}
+
+/**
+ * Builds a balanced tree from key-value pairs sorted by key, constructing the subtrees in parallel.
+ *
+ * @param pool Pool to run the construction on.
+ * @param key_values Key-value pairs sorted by key, without duplicate keys.
+ * @return Root of the built tree, or nullptr if key_values is empty.
+ */
+template <typename TUpdateStrategy, std::totally_ordered TKey, typename TValue>
+typename BSTNode<TKey, TValue, TUpdateStrategy>::NodePtr ParallelBuild(
+    WorkStealingThreadPool& pool, std::vector<std::pair<TKey, TValue>> key_values)
+{
+    return bst_parallel_detail::ParallelBuild<TUpdateStrategy>(
+        pool, key_values.begin(), key_values.end(), bst_parallel_detail::SplitDepth(pool));
+}
+
+#endif  // BINARY_SEARCH_TREE_BST_PARALLEL_HPP
@@ -0,0 +1,388 @@
+#ifndef BINARY_SEARCH_TREE_BST_SET_OPERATIONS_HPP
+#define BINARY_SEARCH_TREE_BST_SET_OPERATIONS_HPP
+
+#include "bst_node.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+// Join-based set operations on whole binary search trees.
+//
+// A tree is represented by the pointer to its root node, and nullptr represents the empty tree.
+// The operations take ownership of their input trees and rebuild the result from the input nodes,
+// without copying keys or values. None of them recurses, so trees of any height are handled
+// within a constant amount of stack.
+//
+// The trees are not rebalanced as they are combined. Split and Join take time proportional to the
+// height of the trees, and Union, Intersection and Difference split one tree by every node of the
+// other that they visit, which takes O(m log(n/m)) time for trees of m <= n nodes only as long as
+// the trees keep logarithmic height. Trees built from sorted keys, such as through BSTFinger, are
+// linear instead, and every Join can add a level to the result, so Balance such trees before
+// combining them repeatedly.
+
+/**
+ * Result of splitting a tree by a key.
+ */
+template <typename TNode>
+struct SplitResult
+{
+    /// Tree of the nodes with keys less than the split key.
+    typename TNode::NodePtr less;
+    /// The node with the split key, disconnected from its descendants, or nullptr if not found.
+    typename TNode::NodePtr equal;
+    /// Tree of the nodes with keys greater than the split key.
+    typename TNode::NodePtr greater;
+};
+
+namespace bst_set_operations_detail
+{
+/**
+ * Result of dividing a set operation on two trees by the root of one of them.
+ */
+template <typename TNode>
+struct Division
+{
+    /// Node to connect the results of the two subproblems to, or nullptr to join them.
+    typename TNode::NodePtr pivot;
+    /// Subproblems on the trees of the keys less and greater than the pivot key, as lhs-rhs pairs.
+    std::pair<typename TNode::NodePtr, typename TNode::NodePtr> less;
+    std::pair<typename TNode::NodePtr, typename TNode::NodePtr> greater;
+};
+
+/**
+ * Solves a divide-and-conquer set operation on two trees with an explicit stack.
+ *
+ * @param solve Returns the result for a pair of trees it can solve directly, or nullopt.
+ * @param divide Divides a pair of trees that solve returned nullopt for, see Division.
+ * @return Result for lhs and rhs.
+ */
+template <typename TNode, typename TSolve, typename TDivide>
+typename TNode::NodePtr Combine(typename TNode::NodePtr lhs,
+                                typename TNode::NodePtr rhs,
+                                TSolve solve,
+                                TDivide divide);
+}  // namespace bst_set_operations_detail
+
+/**
+ * Splits the tree into the nodes with keys less than, equal to and greater than the key.
+ *
+ * @param tree Tree to split.
+ * @param key Key to split by.
+ * @return SplitResult consisting of the nodes of the tree.
+ */
+template <typename TNode>
+SplitResult<TNode> Split(std::shared_ptr<TNode> tree, const typename TNode::KeyType& key)
+{
+    SplitResult<TNode> split;
+    // Nodes are appended top-down: lesser nodes as right descendants of the last lesser node, and
+    // greater nodes as left descendants of the last greater node.
+    std::shared_ptr<TNode> last_less;
+    std::shared_ptr<TNode> last_greater;
+    const auto append_less = [&](std::shared_ptr<TNode> node) {
+        if (last_less)
+        {
+            last_less->Connect(Direction::kRight, node);
+        }
+        else
+        {
+            split.less = node;
+        }
+        last_less = std::move(node);
+    };
+    const auto append_greater = [&](std::shared_ptr<TNode> node) {
+        if (last_greater)
+        {
+            last_greater->Connect(Direction::kLeft, node);
+        }
+        else
+        {
+            split.greater = node;
+        }
+        last_greater = std::move(node);
+    };
+
+    while (tree)
+    {
+        if (key < tree->Key())
+        {
+            auto next = tree->Disconnect(Direction::kLeft);
+            append_greater(std::move(tree));
+            tree = std::move(next);
+        }
+        else if (tree->Key() < key)
+        {
+            auto next = tree->Disconnect(Direction::kRight);
+            append_less(std::move(tree));
+            tree = std::move(next);
+        }
+        else
+        {
+            if (auto less = tree->Disconnect(Direction::kLeft))
+            {
+                append_less(std::move(less));
+            }
+            if (auto greater = tree->Disconnect(Direction::kRight))
+            {
+                append_greater(std::move(greater));
+            }
+            split.equal = std::move(tree);
+        }
+    }
+    return split;
+}
+
+/**
+ * Joins two trees, such that all the keys in less are less than all the keys in greater.
+ *
+ * The node with the greatest key in less becomes the root of the joined tree, so the height of the
+ * joined tree exceeds the height of the taller input tree by at most one.
+ *
+ * @param less Tree with the lesser keys.
+ * @param greater Tree with the greater keys.
+ * @return Joined tree.
+ */
+template <typename TNode>
+std::shared_ptr<TNode> Join(std::shared_ptr<TNode> less, std::shared_ptr<TNode> greater)
+{
+    if (!less)
+    {
+        return greater;
+    }
+    if (!greater)
+    {
+        return less;
+    }
+
+    // Detach the greatest node of less to serve as the new root.
+    auto root = less;
+    std::shared_ptr<TNode> parent;
+    while (root->Right())
+    {
+        parent = root;
+        root = root->Right();
+    }
+    if (parent)
+    {
+        parent->Connect(Direction::kRight, root->Disconnect(Direction::kLeft));
+        root->Connect(Direction::kLeft, std::move(less));
+    }
+
+    root->Connect(Direction::kRight, std::move(greater));
+    return root;
+}
+
+/**
+ * Relinks the nodes of the tree into a tree of minimal height, in time linear in its size.
+ *
+ * @param tree Tree to balance.
+ * @return Balanced tree with the nodes of tree.
+ */
+template <typename TNode>
+std::shared_ptr<TNode> Balance(std::shared_ptr<TNode> tree)
+{
+    // Collect the nodes in key order, disconnecting them on the way.
+    std::vector<std::shared_ptr<TNode>> nodes;
+    std::vector<std::shared_ptr<TNode>> parents;
+    while (tree || !parents.empty())
+    {
+        if (tree)
+        {
+            auto left = tree->Disconnect(Direction::kLeft);
+            parents.push_back(std::move(tree));
+            tree = std::move(left);
+            continue;
+        }
+        auto node = std::move(parents.back());
+        parents.pop_back();
+        tree = node->Disconnect(Direction::kRight);
+        nodes.push_back(std::move(node));
+    }
+
+    // The middle node of every range becomes the root of its subtree. The ranges halve at every
+    // level, so the recursion is logarithmic.
+    const auto build = [&nodes](const auto& self, std::size_t begin, std::size_t end) {
+        if (begin == end)
+        {
+            return std::shared_ptr<TNode>();
+        }
+        const auto middle = begin + (end - begin) / 2;
+        auto root = std::move(nodes[middle]);
+        root->Connect(Direction::kLeft, self(self, begin, middle));
+        root->Connect(Direction::kRight, self(self, middle + 1, end));
+        return root;
+    };
+    return build(build, 0, nodes.size());
+}
+
+/**
+ * Computes the union of two trees. For keys found in both trees, the node of lhs is kept, and the
+ * node of rhs is merged into it by the update strategy of the tree, as if inserted into lhs.
+ *
+ * @param lhs Tree of the existing nodes.
+ * @param rhs Tree of the nodes to add.
+ * @return Tree with the keys found in any of the input trees.
+ */
+template <typename TNode>
+std::shared_ptr<TNode> Union(std::shared_ptr<TNode> lhs, std::shared_ptr<TNode> rhs)
+{
+    using NodePtr = std::shared_ptr<TNode>;
+    return bst_set_operations_detail::Combine<TNode>(
+        std::move(lhs),
+        std::move(rhs),
+        [](NodePtr& lhs, NodePtr& rhs) -> std::optional<NodePtr> {
+            if (!lhs || !rhs)
+            {
+                return lhs ? std::move(lhs) : std::move(rhs);
+            }
+            return std::nullopt;
+        },
+        [](NodePtr lhs, NodePtr rhs) {
+            auto split = Split(std::move(rhs), lhs->Key());
+            if (split.equal)
+            {
+                lhs->Insert(std::move(split.equal));
+            }
+            auto left = lhs->Disconnect(Direction::kLeft);
+            auto right = lhs->Disconnect(Direction::kRight);
+            return bst_set_operations_detail::Division<TNode>{
+                std::move(lhs),
+                {std::move(left), std::move(split.less)},
+                {std::move(right), std::move(split.greater)}};
+        });
+}
+
+/**
+ * Computes the intersection of two trees. The node of rhs is merged into the node of lhs by the
+ * update strategy of the tree, as if inserted into lhs.
+ *
+ * @param lhs Tree of the existing nodes.
+ * @param rhs Tree of the nodes to intersect with.
+ * @return Tree with the keys found in both input trees.
+ */
+template <typename TNode>
+std::shared_ptr<TNode> Intersection(std::shared_ptr<TNode> lhs, std::shared_ptr<TNode> rhs)
+{
+    using NodePtr = std::shared_ptr<TNode>;
+    return bst_set_operations_detail::Combine<TNode>(
+        std::move(lhs),
+        std::move(rhs),
+        [](NodePtr& lhs, NodePtr& rhs) -> std::optional<NodePtr> {
+            if (!lhs || !rhs)
+            {
+                return NodePtr();
+            }
+            return std::nullopt;
+        },
+        [](NodePtr lhs, NodePtr rhs) {
+            auto split = Split(std::move(rhs), lhs->Key());
+            auto left = lhs->Disconnect(Direction::kLeft);
+            auto right = lhs->Disconnect(Direction::kRight);
+            if (split.equal)
+            {
+                lhs->Insert(std::move(split.equal));
+            }
+            else
+            {
+                lhs.reset();
+            }
+            return bst_set_operations_detail::Division<TNode>{
+                std::move(lhs),
+                {std::move(left), std::move(split.less)},
+                {std::move(right), std::move(split.greater)}};
+        });
+}
+
+/**
+ * Computes the difference of two trees.
+ *
+ * @param lhs Tree to remove the keys from.
+ * @param rhs Tree of the keys to remove.
+ * @return Tree with the nodes of lhs whose keys are not found in rhs.
+ */
+template <typename TNode>
+std::shared_ptr<TNode> Difference(std::shared_ptr<TNode> lhs, std::shared_ptr<TNode> rhs)
+{
+    using NodePtr = std::shared_ptr<TNode>;
+    return bst_set_operations_detail::Combine<TNode>(
+        std::move(lhs),
+        std::move(rhs),
+        [](NodePtr& lhs, NodePtr& rhs) -> std::optional<NodePtr> {
+            if (!lhs || !rhs)
+            {
+                return std::move(lhs);
+            }
+            return std::nullopt;
+        },
+        [](NodePtr lhs, NodePtr rhs) {
+            auto split = Split(std::move(lhs), rhs->Key());
+            auto left = rhs->Disconnect(Direction::kLeft);
+            auto right = rhs->Disconnect(Direction::kRight);
+            return bst_set_operations_detail::Division<TNode>{
+                nullptr,
+                {std::move(split.less), std::move(left)},
+                {std::move(split.greater), std::move(right)}};
+        });
+}
+
+template <typename TNode, typename TSolve, typename TDivide>
+typename TNode::NodePtr bst_set_operations_detail::Combine(typename TNode::NodePtr lhs,
+                                                           typename TNode::NodePtr rhs,
+                                                           TSolve solve,
+                                                           TDivide divide)
+{
+    using NodePtr = typename TNode::NodePtr;
+
+    // A step either solves a pair of trees, or combines the two topmost results under a pivot.
+    struct Step
+    {
+        NodePtr lhs;
+        NodePtr rhs;
+        bool combine;
+        NodePtr pivot;
+    };
+
+    std::vector<Step> steps;
+    std::vector<NodePtr> results;
+    steps.push_back({std::move(lhs), std::move(rhs), false, nullptr});
+    while (!steps.empty())
+    {
+        auto step = std::move(steps.back());
+        steps.pop_back();
+
+        if (step.combine)
+        {
+            auto greater = std::move(results.back());
+            results.pop_back();
+            auto less = std::move(results.back());
+            results.pop_back();
+            if (step.pivot)
+            {
+                step.pivot->Connect(Direction::kLeft, std::move(less));
+                step.pivot->Connect(Direction::kRight, std::move(greater));
+                results.push_back(std::move(step.pivot));
+            }
+            else
+            {
+                results.push_back(Join(std::move(less), std::move(greater)));
+            }
+            continue;
+        }
+
+        if (auto solved = solve(step.lhs, step.rhs))
+        {
+            results.push_back(std::move(*solved));
+            continue;
+        }
+        // The lesser subproblem is on top, so its result is pushed first.
+        auto [pivot, less, greater] = divide(std::move(step.lhs), std::move(step.rhs));
+        steps.push_back({nullptr, nullptr, true, std::move(pivot)});
+        steps.push_back({std::move(greater.first), std::move(greater.second), false, nullptr});
+        steps.push_back({std::move(less.first), std::move(less.second), false, nullptr});
+    }
+    return std::move(results.back());
+}
+
+#endif  // BINARY_SEARCH_TREE_BST_SET_OPERATIONS_HPP
@@ -0,0 +1,127 @@
+#ifndef BINARY_SEARCH_TREE_BST_STATS_HPP
+#define BINARY_SEARCH_TREE_BST_STATS_HPP
+
+#include <data-structures/instrumentation/stats.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Statistics of the operations on binary search trees of one type, see BSTNode::Stats. The
+ * comparisons of an operation are the nodes whose keys it compared against.
+ */
+struct BSTStats
+{
+    OperationStats insert;
+    OperationStats find;
+    OperationStats remove;
+    /// Positioning of iterators by Begin and LowerBound.
+    OperationStats iteration;
+};
+
+/**
+ * Shape of a binary search tree.
+ */
+struct BSTShape
+{
+    std::size_t node_count = 0;
+    /// Number of nodes on the longest path from the root to a leaf.
+    std::size_t height = 0;
+    /// Number of nodes at every depth, starting with the root at depth 0.
+    std::vector<std::uint64_t> nodes_per_depth;
+    /// Mean depth of a node. A successful Find compares one more key than the depth of its node.
+    double mean_depth = 0.0;
+    /// Height of the right subtree of the root minus that of the left one.
+    std::int64_t root_balance = 0;
+    /// Largest difference between the heights of the two subtrees of any node.
+    std::size_t max_imbalance = 0;
+};
+
+/**
+ * Measures the shape of the tree rooted at root by visiting all of its nodes.
+ *
+ * @tparam TNode BSTNode type
+ */
+template <typename TNode>
+BSTShape MeasureShape(const TNode& root)
+{
+    BSTShape shape;
+
+    // Nodes in pre-order with their depths. Descendants follow their ancestors, so heights can be
+    // computed by visiting the nodes in reverse.
+    std::vector<std::pair<const TNode*, std::size_t>> nodes;
+    std::vector<std::pair<const TNode*, std::size_t>> pending{{&root, 0}};
+    while (!pending.empty())
+    {
+        const auto [node, depth] = pending.back();
+        pending.pop_back();
+        nodes.emplace_back(node, depth);
+        if (node->Right())
+        {
+            pending.emplace_back(node->Right().get(), depth + 1);
+        }
+        if (node->Left())
+        {
+            pending.emplace_back(node->Left().get(), depth + 1);
+        }
+    }
+
+    std::unordered_map<const TNode*, std::size_t> heights;
+    const auto height_of = [&heights](const auto& node) {
+        return node ? heights.at(node.get()) : std::size_t{0};
+    };
+
+    std::uint64_t depth_sum = 0;
+    for (auto it = nodes.rbegin(); it != nodes.rend(); ++it)
+    {
+        const auto [node, depth] = *it;
+        const auto left = height_of(node->Left());
+        const auto right = height_of(node->Right());
+        heights.emplace(node, std::max(left, right) + 1);
+        shape.max_imbalance =
+            std::max(shape.max_imbalance, left > right ? left - right : right - left);
+
+        if (shape.nodes_per_depth.size() <= depth)
+        {
+            shape.nodes_per_depth.resize(depth + 1);
+        }
+        ++shape.nodes_per_depth[depth];
+        depth_sum += depth;
+    }
+
+    shape.node_count = nodes.size();
+    shape.height = heights.at(&root);
+    shape.mean_depth = static_cast<double>(depth_sum) / static_cast<double>(nodes.size());
+    shape.root_balance = static_cast<std::int64_t>(height_of(root.Right()))
+                         - static_cast<std::int64_t>(height_of(root.Left()));
+    return shape;
+}
+
+inline std::string ToJson(const BSTStats& stats)
+{
+    return JsonObject()
+        .AddRaw("insert", ToJson(stats.insert))
+        .AddRaw("find", ToJson(stats.find))
+        .AddRaw("remove", ToJson(stats.remove))
+        .AddRaw("iteration", ToJson(stats.iteration))
+        .Str();
+}
+
+inline std::string ToJson(const BSTShape& shape)
+{
+    return JsonObject()
+        .Add("node_count", std::uint64_t{shape.node_count})
+        .Add("height", std::uint64_t{shape.height})
+        .Add("nodes_per_depth", shape.nodes_per_depth)
+        .Add("mean_depth", shape.mean_depth)
+        .Add("root_balance", shape.root_balance)
+        .Add("max_imbalance", std::uint64_t{shape.max_imbalance})
+        .Str();
+}
+
+#endif  // BINARY_SEARCH_TREE_BST_STATS_HPP
@@ -0,0 +1,120 @@
+#ifndef BINARY_SEARCH_TREE_BT_ACCESS_POLICIES_HPP
+#define BINARY_SEARCH_TREE_BT_ACCESS_POLICIES_HPP
+
+#include "bst_node.hpp"
+
+#include <cstddef>
+#include <vector>
+
+/*
+ * Access policies decide how a tree restructures itself when a key is accessed through
+ * BSTNode::Find or BSTNode::Insert. A policy is called with the path of nodes from the root to the
+ * accessed node, and returns the node that holds the accessed key afterwards.
+ */
+
+/**
+ * Leaves the shape of the tree untouched. BSTNode skips collecting the access path altogether
+ * under this policy.
+ */
+struct StaticAccess
+{
+    template <typename TNode>
+    TNode* operator()(const std::vector<TNode*>& path) const
+    {
+        return path.back();
+    }
+};
+
+namespace bt_access_detail {
+
+template <typename TNode>
+Direction DirectionOf(const TNode& parent, const TNode* child)
+{
+    return parent.Left().get() == child ? Direction::kLeft : Direction::kRight;
+}
+
+}  // namespace bt_access_detail
+
+/**
+ * Splays the accessed node to the root by zig-zig and zig-zag double rotations, so that
+ * frequently and recently accessed keys stay close to the root. Access costs are amortized
+ * logarithmic, and sequences of accesses with a skewed distribution cost as much as in the static
+ * tree that is optimal for that distribution, up to a constant factor.
+ */
+struct SplayOnAccess
+{
+    template <typename TNode>
+    TNode* operator()(const std::vector<TNode*>& path) const
+    {
+        using bt_access_detail::DirectionOf;
+
+        auto index = path.size() - 1;
+        while (index >= 2)
+        {
+            auto& grandparent = *path[index - 2];
+            auto& parent = *path[index - 1];
+            const auto direction = DirectionOf(parent, path[index]);
+            const auto parent_direction = DirectionOf(grandparent, &parent);
+            if (direction == parent_direction)
+            {
+                grandparent.Rotate(parent_direction);
+                grandparent.Rotate(parent_direction);
+            }
+            else
+            {
+                parent.Rotate(direction);
+                grandparent.Rotate(parent_direction);
+            }
+            // Rotations exchange contents, so the accessed key is now held by the grandparent.
+            index -= 2;
+        }
+        if (index == 1)
+        {
+            path[0]->Rotate(DirectionOf(*path[0], path[1]));
+        }
+        return path[0];
+    }
+};
+
+/**
+ * Semi-splaying: in the zig-zig case only the parent is rotated, and the adjustment continues from
+ * the parent instead of the accessed node. Every access roughly halves the depth of the nodes on
+ * the access path while doing about half the rotations of splaying, and the accessed key is not
+ * moved all the way to the root.
+ */
+struct SemiSplayOnAccess
+{
+    template <typename TNode>
+    TNode* operator()(const std::vector<TNode*>& path) const
+    {
+        using bt_access_detail::DirectionOf;
+
+        auto accessed = path.back();
+        auto index = path.size() - 1;
+        while (index >= 2)
+        {
+            auto& grandparent = *path[index - 2];
+            auto& parent = *path[index - 1];
+            const auto direction = DirectionOf(parent, path[index]);
+            const auto parent_direction = DirectionOf(grandparent, &parent);
+            if (direction == parent_direction)
+            {
+                // The node at index keeps its contents, and the parent's move to the grandparent.
+                grandparent.Rotate(parent_direction);
+            }
+            else
+            {
+                parent.Rotate(direction);
+                grandparent.Rotate(parent_direction);
+                if (accessed == path[index])
+                {
+                    accessed = &grandparent;
+                }
+            }
+            index -= 2;
+        }
+        return accessed;
+    }
+};
+
+#endif  // BINARY_SEARCH_TREE_BT_ACCESS_POLICIES_HPP
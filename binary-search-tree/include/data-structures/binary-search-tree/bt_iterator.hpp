@@ -5,14 +5,13 @@
 #ifndef BINARY_TREE_BT_ITERATOR_HPP
 #define BINARY_TREE_BT_ITERATOR_HPP
 
+#include "bst_node_fwd.hpp"
+
 #include <concepts>
 #include <memory>
 #include <stack>
 #include <utility>
 
-template <std::totally_ordered TKey, typename TValue, typename TUpdateStrategy>
-class BSTNode;
-
 template <typename... TArgs>
 class BinaryTreeConstIterator
 {
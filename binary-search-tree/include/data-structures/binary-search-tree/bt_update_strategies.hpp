@@ -5,20 +5,20 @@
 #ifndef BINARY_SEARCH_TREE_BT_UPDATE_STRATEGIES_HPP
 #define BINARY_SEARCH_TREE_BT_UPDATE_STRATEGIES_HPP
 
+#include <data-structures/concepts/bt_concepts.hpp>
+
+#include "bst_node_fwd.hpp"
+
 #include <concepts>
+#include <iterator>
 #include <utility>
 
-template <std::totally_ordered TKey, typename TValue, typename TUpdateStrategy>
-class BSTNode;
-
 template <typename... TArgs>
 class RejectUpdates
 {
-    using Node = BSTNode<TArgs..., RejectUpdates<TArgs...>>;
-    using NodePtr = typename Node::NodePtr;
-
 public:
-    std::pair<NodePtr, bool> operator()(Node& this_node, Node&& /* new_node */)
+    template <typename TNode>
+    std::pair<typename TNode::NodePtr, bool> operator()(TNode& this_node, TNode&& /* new_node */)
     {
         return {this_node.shared_from_this(), false};
     }
@@ -27,15 +27,100 @@ public:
 template <typename... TArgs>
 class AcceptUpdates
 {
-    using Node = BSTNode<TArgs..., AcceptUpdates<TArgs...>>;
-    using NodePtr = typename Node::NodePtr;
-
 public:
-    std::pair<NodePtr, bool> operator()(Node& this_node, Node&& new_node)
+    template <typename TNode>
+    std::pair<typename TNode::NodePtr, bool> operator()(TNode& this_node, TNode&& new_node)
     {
         this_node.value_ = std::move(new_node.value_);
         return {this_node.shared_from_this(), true};
     }
 };
 
+/**
+ * Update strategy that combines the value of the existing node with the value of the new node in
+ * place, during the same descent that found the existing node.
+ *
+ * @tparam TMergeOperator Default constructible functor that is called with the existing value and
+ * the new value as rvalue, and merges the latter into the former.
+ */
+template <typename TMergeOperator, typename... TArgs>
+class MergeUpdates
+{
+public:
+    template <typename TNode>
+    std::pair<typename TNode::NodePtr, bool> operator()(TNode& this_node, TNode&& new_node) requires
+        MergeOperatorFor<TMergeOperator, typename TNode::ValueType>
+    {
+        TMergeOperator()(this_node.value_, std::move(new_node.value_));
+        return {this_node.shared_from_this(), true};
+    }
+};
+
+struct SumMerge
+{
+    template <typename TValue>
+    void operator()(TValue& existing, TValue&& update) const requires requires
+    {
+        existing += std::move(update);
+    }
+    {
+        existing += std::move(update);
+    }
+};
+
+struct MinMerge
+{
+    template <std::totally_ordered TValue>
+    void operator()(TValue& existing, TValue&& update) const
+    {
+        if (update < existing)
+        {
+            existing = std::move(update);
+        }
+    }
+};
+
+struct MaxMerge
+{
+    template <std::totally_ordered TValue>
+    void operator()(TValue& existing, TValue&& update) const
+    {
+        if (existing < update)
+        {
+            existing = std::move(update);
+        }
+    }
+};
+
+/**
+ * Appends the elements of the update to the end of the existing container.
+ */
+struct AppendMerge
+{
+    template <typename TContainer>
+    void operator()(TContainer& existing, TContainer&& update) const requires requires
+    {
+        existing.insert(existing.end(),
+                        std::make_move_iterator(update.begin()),
+                        std::make_move_iterator(update.end()));
+    }
+    {
+        existing.insert(existing.end(),
+                        std::make_move_iterator(update.begin()),
+                        std::make_move_iterator(update.end()));
+    }
+};
+
+template <typename... TArgs>
+using SumUpdates = MergeUpdates<SumMerge, TArgs...>;
+
+template <typename... TArgs>
+using MinUpdates = MergeUpdates<MinMerge, TArgs...>;
+
+template <typename... TArgs>
+using MaxUpdates = MergeUpdates<MaxMerge, TArgs...>;
+
+template <typename... TArgs>
+using AppendUpdates = MergeUpdates<AppendMerge, TArgs...>;
+
 #endif  // BINARY_SEARCH_TREE_BT_UPDATE_STRATEGIES_HPP
@@ -0,0 +1,164 @@
+#include <data-structures/binary-search-tree/bst_node.hpp>
+#include <data-structures/binary-search-tree/bt_access_policies.hpp>
+#include <data-structures/binary-search-tree/bt_update_strategies.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+using KeyType = int;
+using ValueType = std::string;
+
+template <typename TNodePtr>
+std::vector<KeyType> Keys(const TNodePtr& root)
+{
+    std::vector<KeyType> keys;
+    for (auto it = root->Begin(); it != root->End(); ++it) { keys.push_back((*it).Key()); }
+    return keys;
+}
+
+template <typename TNodePtr>
+std::size_t Depth(const TNodePtr& root, KeyType key)
+{
+    std::size_t depth = 0;
+    for (auto node = root.get(); node->Key() != key; ++depth)
+    { node = key < node->Key() ? node->Left().get() : node->Right().get(); }
+    return depth;
+}
+
+template <typename TAccessPolicy>
+auto MakeShuffledTree(int size)
+{
+    std::vector<KeyType> keys(size);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+
+    auto root = MakeBSTNode<RejectUpdates<KeyType, ValueType>, TAccessPolicy>(
+        keys[0], std::to_string(keys[0]));
+    for (auto it = std::next(keys.begin()); it != keys.end(); ++it)
+    { root->Insert(*it, std::to_string(*it)); }
+    return root;
+}
+
+template <typename TAccessPolicy>
+class AccessPolicyTest : public testing::Test
+{
+};
+
+using SelfAdjustingPolicies = testing::Types<SplayOnAccess, SemiSplayOnAccess>;
+TYPED_TEST_SUITE(AccessPolicyTest, SelfAdjustingPolicies);
+}  // namespace
+
+TYPED_TEST(AccessPolicyTest, FindKeepsKeysAndValues)
+{
+    constexpr int kSize = 200;
+    const auto root = MakeShuffledTree<TypeParam>(kSize);
+
+    std::mt19937 generator(11);
+    std::uniform_int_distribution<KeyType> distribution(-10, kSize + 10);
+    for (int access = 0; access < 1000; ++access)
+    {
+        const auto key = distribution(generator);
+        const auto found = root->Find(key);
+        if (key < 0 || key >= kSize)
+        {
+            EXPECT_EQ(found, nullptr);
+            continue;
+        }
+        ASSERT_NE(found, nullptr);
+        EXPECT_EQ(found->Key(), key);
+        EXPECT_EQ(found->Value(), std::to_string(key));
+    }
+
+    std::vector<KeyType> expected(kSize);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(Keys(root), expected);
+}
+
+TYPED_TEST(AccessPolicyTest, RepeatedAccessMovesKeyTowardsRoot)
+{
+    const auto root = MakeShuffledTree<TypeParam>(1000);
+    const auto keys = Keys(root);
+    const auto deepest =
+        *std::max_element(keys.begin(), keys.end(), [&root](KeyType lhs, KeyType rhs) {
+            return Depth(root, lhs) < Depth(root, rhs);
+        });
+
+    auto depth = Depth(root, deepest);
+    ASSERT_GT(depth, 2u);
+    while (depth > 1)
+    {
+        root->Find(deepest);
+        const auto new_depth = Depth(root, deepest);
+        EXPECT_LE(new_depth, depth / 2 + 1);
+        depth = new_depth;
+    }
+}
+
+TYPED_TEST(AccessPolicyTest, InsertKeepsKeysAndRespectsUpdateStrategy)
+{
+    using Node = BSTNode<KeyType, ValueType, AcceptUpdates<KeyType, ValueType>, TypeParam>;
+
+    auto root = std::make_shared<Node>(50, "50");
+    for (KeyType key = 0; key < 100; key += 3)
+    {
+        const auto [inserted, success] = root->Insert(key, std::to_string(key));
+        EXPECT_TRUE(success);
+        EXPECT_EQ(inserted->Key(), key);
+    }
+
+    const auto [updated, success] = root->Insert(51, "updated");
+    EXPECT_TRUE(success);
+    EXPECT_EQ(updated->Key(), 51);
+    EXPECT_EQ(root->Find(51)->Value(), "updated");
+    EXPECT_EQ(root->Find(50)->Value(), "50");
+
+    auto keys = Keys(root);
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+    EXPECT_EQ(keys.size(), 35u);
+}
+
+TEST(AccessPolicyShapeTest, SplayMovesAccessedKeyToRoot)
+{
+    const auto root = MakeShuffledTree<SplayOnAccess>(100);
+
+    const auto found = root->Find(42);
+    EXPECT_EQ(found, root);
+    EXPECT_EQ(root->Key(), 42);
+
+    root->Insert(1000, "1000");
+    EXPECT_EQ(root->Key(), 1000);
+    EXPECT_EQ(root->Right(), nullptr);
+}
+
+TEST(AccessPolicyShapeTest, SplayMovesLastVisitedKeyToRootOnMiss)
+{
+    using Node = BSTNode<KeyType, ValueType, RejectUpdates<KeyType, ValueType>, SplayOnAccess>;
+
+    auto root = std::make_shared<Node>(10, "10");
+    root->Insert(20, "20");
+    root->Insert(30, "30");
+
+    EXPECT_EQ(root->Find(25), nullptr);
+    EXPECT_TRUE(root->Key() == 20 || root->Key() == 30);
+    EXPECT_EQ(Keys(root), (std::vector<KeyType>{10, 20, 30}));
+}
+
+TEST(AccessPolicyShapeTest, StaticAccessLeavesShapeUntouched)
+{
+    const auto root = MakeShuffledTree<StaticAccess>(100);
+    const auto root_key = root->Key();
+    const auto depth = Depth(root, 42);
+
+    root->Find(42);
+    root->Insert(1000, "1000");
+    EXPECT_EQ(root->Key(), root_key);
+    EXPECT_EQ(Depth(root, 42), depth);
+}
@@ -0,0 +1,93 @@
+#include <data-structures/binary-search-tree/bst_node.hpp>
+#include <data-structures/binary-search-tree/bst_stats.hpp>
+#include <data-structures/binary-search-tree/bt_update_strategies.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+using Node = BSTNode<int, int, RejectUpdates<int, int>>;
+
+/**
+ *        4
+ *      /   \
+ *     2     6
+ *    / \     \
+ *   1   3     7
+ *              \
+ *               8
+ */
+Node::NodePtr MakeTree()
+{
+    auto root = MakeBSTNode<RejectUpdates<int, int>>(4, 4);
+    for (const auto key : {2, 6, 1, 3, 7, 8}) { root->Insert(key, key); }
+    return root;
+}
+}  // namespace
+
+class BSTStatsTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Node::ResetStats();
+    }
+};
+
+TEST_F(BSTStatsTest, CountsOperationsAndComparisons)
+{
+    auto root = MakeTree();
+    auto stats = Node::Stats();
+    EXPECT_EQ(stats.insert.calls, 6u);
+    // 2 and 6 compare with the root, 1, 3 and 7 with two nodes, and 8 with three.
+    EXPECT_EQ(stats.insert.comparisons, 2u + 3 * 2 + 3);
+    EXPECT_EQ(stats.find.calls, 0u);
+
+    root->Find(8);
+    root->Find(5);
+    stats = Node::Stats();
+    EXPECT_EQ(stats.find.calls, 2u);
+    EXPECT_EQ(stats.find.comparisons, 4u + 2);
+
+    root->Remove(3);
+    root->Begin();
+    root->LowerBound(5);
+    stats = Node::Stats();
+    EXPECT_EQ(stats.remove.calls, 1u);
+    EXPECT_GT(stats.remove.comparisons, 0u);
+    EXPECT_EQ(stats.iteration.calls, 2u);
+    EXPECT_GT(stats.insert.LatencyPercentile(100).count(), 0);
+
+    Node::ResetStats();
+    EXPECT_EQ(Node::Stats().insert.calls, 0u);
+}
+
+TEST_F(BSTStatsTest, MeasureShape)
+{
+    const auto root = MakeTree();
+    const auto shape = MeasureShape(*root);
+    EXPECT_EQ(shape.node_count, 7u);
+    EXPECT_EQ(shape.height, 4u);
+    EXPECT_EQ(shape.nodes_per_depth, (std::vector<std::uint64_t>{1, 2, 3, 1}));
+    EXPECT_DOUBLE_EQ(shape.mean_depth, (0.0 + 2 * 1 + 3 * 2 + 3) / 7);
+    EXPECT_EQ(shape.root_balance, 1);
+    // Node 6 has no left subtree and a right subtree of height 2.
+    EXPECT_EQ(shape.max_imbalance, 2u);
+
+    EXPECT_EQ(ToJson(shape),
+              "{\"node_count\":7,\"height\":4,\"nodes_per_depth\":[1,2,3,1],"
+              "\"mean_depth\":1.571429,\"root_balance\":1,\"max_imbalance\":2}");
+}
+
+TEST_F(BSTStatsTest, MeasureShapeOfDegenerateTree)
+{
+    auto root = MakeBSTNode<RejectUpdates<int, int>>(0, 0);
+    for (int key = 1; key < 5000; ++key) { root->Insert(key, key); }
+    const auto shape = MeasureShape(*root);
+    EXPECT_EQ(shape.height, 5000u);
+    EXPECT_EQ(shape.max_imbalance, 4999u);
+    EXPECT_EQ(shape.root_balance, 4999);
+}
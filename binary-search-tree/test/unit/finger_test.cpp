@@ -0,0 +1,181 @@
+#include <data-structures/binary-search-tree/bst_finger.hpp>
+#include <data-structures/binary-search-tree/bst_node.hpp>
+#include <data-structures/binary-search-tree/bt_update_strategies.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+using KeyType = int;
+using ValueType = std::string;
+using UpdateStrategy = RejectUpdates<KeyType, ValueType>;
+using Node = BSTNode<KeyType, ValueType, UpdateStrategy>;
+using Finger = BSTFinger<Node>;
+
+/**
+ * Key that counts how many times it has been compared.
+ */
+struct CountingKey
+{
+    static inline std::size_t comparisons = 0;
+
+    int value;
+
+    friend bool operator==(const CountingKey& lhs, const CountingKey& rhs)
+    {
+        ++comparisons;
+        return lhs.value == rhs.value;
+    }
+
+    friend std::strong_ordering operator<=>(const CountingKey& lhs, const CountingKey& rhs)
+    {
+        ++comparisons;
+        return lhs.value <=> rhs.value;
+    }
+};
+
+template <typename TNodePtr>
+std::vector<KeyType> Keys(const TNodePtr& root)
+{
+    std::vector<KeyType> keys;
+    for (auto it = root->Begin(); it != root->End(); ++it) { keys.push_back((*it).Key()); }
+    return keys;
+}
+}  // namespace
+
+TEST(FingerTest, AppendsInIncreasingOrder)
+{
+    auto root = MakeBSTNode<UpdateStrategy>(0, std::string("0"));
+    Finger finger(root);
+
+    for (auto key = 1; key < 100; ++key)
+    {
+        const auto insertion = finger.Insert(key, std::to_string(key));
+        EXPECT_TRUE(insertion.second);
+        ASSERT_TRUE(insertion.first);
+        EXPECT_EQ(key, insertion.first->Key());
+        EXPECT_EQ(insertion.first, finger.Node());
+    }
+
+    std::vector<KeyType> expected(100);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(expected, Keys(root));
+    EXPECT_TRUE(root->Find(57));
+}
+
+TEST(FingerTest, InsertsInArbitraryOrder)
+{
+    std::vector<KeyType> keys(200);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+
+    auto root = MakeBSTNode<UpdateStrategy>(keys.front(), std::to_string(keys.front()));
+    Finger finger(root);
+    for (auto it = std::next(keys.begin()); it != keys.end(); ++it)
+    { EXPECT_TRUE(finger.Insert(*it, std::to_string(*it)).second); }
+
+    std::sort(keys.begin(), keys.end());
+    EXPECT_EQ(keys, Keys(root));
+    for (const auto key : keys)
+    {
+        const auto found = root->Find(key);
+        ASSERT_TRUE(found);
+        EXPECT_EQ(std::to_string(key), found->Value());
+    }
+}
+
+TEST(FingerTest, InsertingExistingKeyAppliesUpdateStrategy)
+{
+    using AcceptingNode = BSTNode<KeyType, ValueType, AcceptUpdates<KeyType, ValueType>>;
+
+    auto root = MakeBSTNode<AcceptUpdates<KeyType, ValueType>>(10, std::string("ten"));
+    BSTFinger<AcceptingNode> finger(root);
+    finger.Insert(20, "twenty");
+    finger.Insert(15, "fifteen");
+
+    const auto rejected = Finger(MakeBSTNode<UpdateStrategy>(10, std::string("ten"))).Insert(10, "");
+    EXPECT_FALSE(rejected.second);
+
+    const auto accepted = finger.Insert(10, "TEN");
+    EXPECT_TRUE(accepted.second);
+    EXPECT_EQ(root, accepted.first);
+    EXPECT_EQ("TEN", root->Value());
+}
+
+TEST(FingerTest, InsertionsBypassingFingerKeepItValid)
+{
+    auto root = MakeBSTNode<UpdateStrategy>(50, std::string("50"));
+    Finger finger(root);
+    finger.Insert(60, "60");
+    root->Insert(70, "70");
+    root->Insert(10, "10");
+    finger.Insert(65, "65");
+    finger.Insert(5, "5");
+
+    EXPECT_EQ((std::vector<KeyType>{5, 10, 50, 60, 65, 70}), Keys(root));
+}
+
+TEST(FingerTest, EmptyFingerAndNullNodeInsertNothing)
+{
+    Finger empty(nullptr);
+    EXPECT_FALSE(empty.Insert(1, "one").first);
+    EXPECT_FALSE(empty.Node());
+
+    Finger finger(MakeBSTNode<UpdateStrategy>(0, std::string("root")));
+    const auto null_insert = finger.Insert(nullptr);
+    EXPECT_FALSE(null_insert.first);
+    EXPECT_FALSE(null_insert.second);
+}
+
+TEST(FingerTest, AppendsTakeConstantComparisons)
+{
+    using CountingStrategy = RejectUpdates<CountingKey, int>;
+    using CountingNode = BSTNode<CountingKey, int, CountingStrategy>;
+
+    auto root = MakeBSTNode<CountingStrategy>(CountingKey{0}, 0);
+    BSTFinger<CountingNode> finger(root);
+
+    constexpr auto kAppends = 10000;
+    CountingKey::comparisons = 0;
+    for (auto key = 1; key <= kAppends; ++key) { finger.Insert(CountingKey{key}, key); }
+
+    EXPECT_LE(CountingKey::comparisons, 4 * kAppends);
+}
+
+TEST(FingerTest, RebalanceKeepsAppendsLogarithmic)
+{
+    auto root = MakeBSTNode<UpdateStrategy>(0, std::string("0"));
+    Finger finger(root);
+
+    constexpr auto kAppends = 10000;
+    for (auto key = 1; key < kAppends; ++key)
+    {
+        finger.Insert(key, std::to_string(key));
+        root = finger.Rebalance(key + 1);
+    }
+
+    std::vector<KeyType> expected(kAppends);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(expected, Keys(root));
+
+    // Every search path is within the depth bound, log_{3/2}(10000) < 23.
+    for (auto key = 0; key < kAppends; key += 97)
+    {
+        std::size_t depth = 0;
+        for (auto node = root; node->Key() != key;
+             node = key < node->Key() ? node->Left() : node->Right())
+        { ++depth; }
+        EXPECT_LE(depth, 23u);
+    }
+    const auto found = root->Find(kAppends - 1);
+    ASSERT_TRUE(found);
+    EXPECT_EQ(std::to_string(kAppends - 1), found->Value());
+}
@@ -8,6 +8,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -30,6 +34,25 @@ using KeyType = int;
 using ValueType = std::string;
 using UpdateStrategy = DummyUpdateStrategy<KeyType, ValueType>;
 using Node = BSTNode<int, std::string, UpdateStrategy>;
+
+std::vector<int> Keys(const Node::NodePtr& root)
+{
+    std::vector<int> keys;
+    for (auto it = root->Begin(); it != root->End(); ++it) { keys.push_back((*it).Key()); }
+    return keys;
+}
+
+std::size_t Height(const Node::NodePtr& node)
+{
+    return node ? 1 + std::max(Height(node->Left()), Height(node->Right())) : 0;
+}
+
+Node::NodePtr MakeTreeOfKeys(const std::vector<int>& keys)
+{
+    std::vector<std::pair<int, std::string>> input;
+    for (const auto key : keys) { input.emplace_back(key, std::to_string(key)); }
+    return MakeTree<UpdateStrategy>(input);
+}
 }  // namespace
 
 TEST(RemoveNextTest, NextIsLeaf)
@@ -126,3 +149,131 @@ TEST(NodeDeletionTest, DeleteRootNode_AnotherNodeBecomesRoot)
     EXPECT_TRUE(root->Find(1));
     EXPECT_TRUE(root->Find(3));
 }
+
+TEST(RemoveNextTest, NextHasTwoDescendants_SuccessorIsSplicedIn)
+{
+    const auto root = MakeTreeOfKeys({0, 10, 5, 20, 15, 12, 30});
+
+    const auto removed = root->RemoveNext(Direction::kRight);
+    ASSERT_TRUE(removed);
+    EXPECT_EQ(10, removed->Key());
+    EXPECT_FALSE(removed->Left());
+    EXPECT_FALSE(removed->Right());
+
+    ASSERT_TRUE(root->Right());
+    EXPECT_EQ(12, root->Right()->Key());
+    EXPECT_EQ(Keys(root), (std::vector<int>{0, 5, 12, 15, 20, 30}));
+}
+
+TEST(NodeDeletionTest, DeleteRootWithTwoDescendants_SuccessorMovesIntoRoot)
+{
+    const auto root = MakeTreeOfKeys({10, 5, 20, 15, 30});
+
+    const auto removed = root->Remove(10);
+    ASSERT_TRUE(removed);
+    EXPECT_EQ("10", removed->Value());
+    EXPECT_EQ(15, root->Key());
+    EXPECT_EQ("15", root->Value());
+    EXPECT_EQ(Keys(root), (std::vector<int>{5, 15, 20, 30}));
+    EXPECT_EQ(Height(root), 3u);
+}
+
+TEST(NodeDeletionTest, RandomChurnKeepsKeysAndShape)
+{
+    std::mt19937 random(3);
+    std::uniform_int_distribution<int> distribution(1, 4000);
+
+    const auto root = MakeTreeOfKeys({0});
+    std::set<int> expected{0};
+    for (int operation = 0; operation < 20000; ++operation)
+    {
+        const auto key = distribution(random);
+        if (expected.count(key))
+        {
+            const auto removed = root->Remove(key);
+            ASSERT_TRUE(removed);
+            EXPECT_EQ(key, removed->Key());
+            expected.erase(key);
+        }
+        else
+        {
+            root->Insert(key, std::to_string(key));
+            expected.insert(key);
+        }
+    }
+
+    EXPECT_EQ(Keys(root), std::vector<int>(expected.begin(), expected.end()));
+    // A random tree of about 2000 keys is expected to be about 25 levels high.
+    EXPECT_LT(Height(root), 60u);
+}
+
+TEST(RemoveRangeTest, RemovesKeysInHalfOpenRange)
+{
+    const auto root = MakeTreeOfKeys({50, 20, 80, 10, 30, 25, 35, 70, 90, 60, 75});
+
+    EXPECT_EQ(6u, root->RemoveRange(25, 75));
+    EXPECT_EQ(Keys(root), (std::vector<int>{10, 20, 75, 80, 90}));
+    EXPECT_EQ("75", root->Find(75)->Value());
+}
+
+TEST(RemoveRangeTest, RangeBelowRoot)
+{
+    const auto root = MakeTreeOfKeys({50, 20, 80, 10, 30, 25, 35});
+
+    EXPECT_EQ(3u, root->RemoveRange(21, 40));
+    EXPECT_EQ(Keys(root), (std::vector<int>{10, 20, 50, 80}));
+}
+
+TEST(RemoveRangeTest, EmptyOrDisjointRange)
+{
+    const auto root = MakeTreeOfKeys({50, 20, 80});
+
+    EXPECT_EQ(0u, root->RemoveRange(30, 30));
+    EXPECT_EQ(0u, root->RemoveRange(60, 40));
+    EXPECT_EQ(0u, root->RemoveRange(81, 100));
+    EXPECT_EQ(0u, root->RemoveRange(21, 50));
+    EXPECT_EQ(Keys(root), (std::vector<int>{20, 50, 80}));
+}
+
+TEST(RemoveRangeTest, RangeCoveringAllKeys_RootKeepsItsKey)
+{
+    const auto root = MakeTreeOfKeys({50, 20, 80, 10, 90});
+
+    EXPECT_EQ(4u, root->RemoveRange(0, 100));
+    EXPECT_EQ(Keys(root).size(), 1u);
+}
+
+TEST(RemoveRangeTest, MatchesRemovingKeysOneByOne)
+{
+    std::vector<int> keys(1000);
+    for (int index = 0; index < 1000; ++index) { keys[index] = index; }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(5));
+
+    std::mt19937 random(9);
+    std::uniform_int_distribution<int> distribution(-10, 1010);
+    for (int round = 0; round < 50; ++round)
+    {
+        auto lo = distribution(random);
+        auto hi = distribution(random);
+        if (hi < lo)
+        {
+            std::swap(lo, hi);
+        }
+
+        const auto root = MakeTreeOfKeys(keys);
+        std::vector<int> expected;
+        std::copy_if(keys.begin(), keys.end(), std::back_inserter(expected), [&](int key) {
+            return key < lo || key >= hi;
+        });
+        std::sort(expected.begin(), expected.end());
+
+        const auto removed = root->RemoveRange(lo, hi);
+        if (expected.empty())
+        {
+            EXPECT_EQ(Keys(root).size(), 1u);
+            continue;
+        }
+        EXPECT_EQ(removed, keys.size() - expected.size());
+        EXPECT_EQ(Keys(root), expected);
+    }
+}
@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include <string>
+#include <vector>
 
 namespace
 {
@@ -86,3 +87,74 @@ TEST(NodeInsertionTest, InsertingNullNodeFails)
     EXPECT_FALSE(null_insert.second);
     EXPECT_FALSE(null_insert.first);
 }
+
+TEST(NodeInsertionTest, UpdateStrategySum_InsertingExistingNodeAccumulates)
+{
+    using UpdateStrategy = SumUpdates<KeyType, int>;
+
+    auto root = MakeBSTNode<UpdateStrategy>(0, 1);
+    root->Insert(1, 10);
+
+    const auto root_merge = root->Insert(0, 2);
+    EXPECT_TRUE(root_merge.second);
+    ASSERT_TRUE(root_merge.first);
+    EXPECT_EQ(root, root_merge.first);
+    EXPECT_EQ(3, root_merge.first->Value());
+
+    root->Insert(1, 20);
+    root->Insert(1, 30);
+    const auto merged_node = root->Find(1);
+    ASSERT_TRUE(merged_node);
+    EXPECT_EQ(60, merged_node->Value());
+}
+
+TEST(NodeInsertionTest, UpdateStrategyMinMax_InsertingExistingNodeKeepsExtremum)
+{
+    auto min_root = MakeBSTNode<MinUpdates<KeyType, int>>(0, 5);
+    auto max_root = MakeBSTNode<MaxUpdates<KeyType, int>>(0, 5);
+
+    for (const auto value : {7, 2, 9, 4})
+    {
+        min_root->Insert(0, value);
+        max_root->Insert(0, value);
+    }
+
+    EXPECT_EQ(2, min_root->Value());
+    EXPECT_EQ(9, max_root->Value());
+}
+
+TEST(NodeInsertionTest, UpdateStrategyAppend_InsertingExistingNodeAppends)
+{
+    using UpdateStrategy = AppendUpdates<KeyType, std::vector<int>>;
+
+    auto root = MakeBSTNode<UpdateStrategy>(0, std::vector<int>{1});
+    root->Insert(0, {2, 3});
+    root->Insert(-1, {4});
+    root->Insert(0, {5});
+
+    EXPECT_EQ((std::vector<int>{1, 2, 3, 5}), root->Value());
+    const auto left = root->Find(-1);
+    ASSERT_TRUE(left);
+    EXPECT_EQ(std::vector<int>{4}, left->Value());
+}
+
+TEST(NodeInsertionTest, UpdateStrategyCustomMerge_InsertingExistingNodeMerges)
+{
+    struct KeepLongest
+    {
+        void operator()(std::string& existing, std::string&& update) const
+        {
+            if (update.size() > existing.size())
+            {
+                existing = std::move(update);
+            }
+        }
+    };
+    using UpdateStrategy = MergeUpdates<KeepLongest, KeyType, ValueType>;
+
+    auto root = MakeBSTNode<UpdateStrategy>(0, std::string("root"));
+    root->Insert(0, "uprooted");
+    root->Insert(0, "up");
+
+    EXPECT_EQ("uprooted", root->Value());
+}
@@ -66,3 +66,38 @@ TEST(NodeSearchTest, FindMissingNodes)
 
     EXPECT_FALSE(root->Find(2));
 }
+
+TEST(NodeSearchTest, LowerBoundIteratesFromFirstNotLessKey)
+{
+    const std::vector<std::pair<int, std::string>> input = {
+        {10, "ten"}, {5, "five"}, {15, "fifteen"}, {7, "seven"}, {12, "twelve"}, {20, "twenty"}};
+
+    const auto root = MakeTree<UpdateStrategy>(input);
+
+    auto it = root->LowerBound(8);
+    for (const auto expected_key : {10, 12, 15, 20})
+    {
+        ASSERT_NE(root->End(), it);
+        EXPECT_EQ(expected_key, (*it).Key());
+        ++it;
+    }
+    EXPECT_EQ(root->End(), it);
+
+    auto exact = root->LowerBound(12);
+    ASSERT_NE(root->End(), exact);
+    EXPECT_EQ(12, (*exact).Key());
+
+    auto first = root->LowerBound(-100);
+    ASSERT_NE(root->End(), first);
+    EXPECT_EQ(5, (*first).Key());
+}
+
+TEST(NodeSearchTest, LowerBoundPastLastKeyReturnsEnd)
+{
+    const std::vector<std::pair<int, std::string>> input = {
+        {0, "root"}, {-1, "left"}, {1, "right"}, {3, "three"}};
+
+    const auto root = MakeTree<UpdateStrategy>(input);
+
+    EXPECT_EQ(root->End(), root->LowerBound(4));
+}
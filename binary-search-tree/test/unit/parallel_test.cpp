@@ -0,0 +1,144 @@
+#include <data-structures/binary-search-tree/bst_node.hpp>
+#include <data-structures/binary-search-tree/bst_parallel.hpp>
+#include <data-structures/binary-search-tree/bt_update_strategies.hpp>
+
+#include "test_helpers.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace
+{
+using KeyType = int;
+using ValueType = std::int64_t;
+using UpdateStrategy = RejectUpdates<KeyType, ValueType>;
+using Node = BSTNode<KeyType, ValueType, UpdateStrategy>;
+
+std::vector<std::pair<KeyType, ValueType>> MakeSortedInput(int size)
+{
+    std::vector<std::pair<KeyType, ValueType>> key_values;
+    for (auto key = 0; key < size; ++key) { key_values.emplace_back(key, key * 10); }
+    return key_values;
+}
+}  // namespace
+
+class ParallelTest : public testing::TestWithParam<std::size_t>
+{
+protected:
+    WorkStealingThreadPool pool_{GetParam()};
+};
+
+TEST_P(ParallelTest, BuildProducesOrderedBalancedTree)
+{
+    const auto input = MakeSortedInput(1000);
+    const auto root = ParallelBuild<UpdateStrategy>(pool_, input);
+    ASSERT_TRUE(root);
+
+    auto it = root->Begin();
+    for (const auto& expected : input)
+    {
+        ASSERT_NE(root->End(), it);
+        EXPECT_EQ(expected.first, (*it).Key());
+        EXPECT_EQ(expected.second, (*it).Value());
+        ++it;
+    }
+    EXPECT_EQ(root->End(), it);
+
+    // A balanced tree of 1000 nodes is 10 levels deep.
+    std::function<int(const Node*)> height = [&](const Node* node) {
+        return node ? 1 + std::max(height(node->Left().get()), height(node->Right().get())) : 0;
+    };
+    EXPECT_EQ(10, height(root.get()));
+}
+
+TEST_P(ParallelTest, BuildFromEmptyInputReturnsNull)
+{
+    EXPECT_FALSE(ParallelBuild<UpdateStrategy>(pool_, std::vector<std::pair<KeyType, ValueType>>{}));
+}
+
+TEST_P(ParallelTest, ForEachVisitsEveryNodeOnce)
+{
+    const auto root = ParallelBuild<UpdateStrategy>(pool_, MakeSortedInput(1000));
+
+    std::vector<std::atomic<int>> visits(1000);
+    ParallelForEach(pool_, *root, [&visits](const Node& node) { ++visits[node.Key()]; });
+
+    for (const auto& count : visits) { EXPECT_EQ(1, count.load()); }
+}
+
+TEST_P(ParallelTest, ForEachInRangeVisitsOnlyRange)
+{
+    const auto root = ParallelBuild<UpdateStrategy>(pool_, MakeSortedInput(1000));
+
+    std::vector<std::atomic<int>> visits(1000);
+    ParallelForEach(pool_, *root, 250, 750, [&visits](const Node& node) { ++visits[node.Key()]; });
+
+    for (auto key = 0; key < 1000; ++key)
+    { EXPECT_EQ(key >= 250 && key < 750 ? 1 : 0, visits[key].load()) << "key " << key; }
+}
+
+TEST_P(ParallelTest, ForEachInEmptyRangeVisitsNothing)
+{
+    const auto root = ParallelBuild<UpdateStrategy>(pool_, MakeSortedInput(1000));
+
+    std::atomic<int> visits = 0;
+    ParallelForEach(pool_, *root, 500, 500, [&visits](const Node&) { ++visits; });
+
+    EXPECT_EQ(0, visits.load());
+}
+
+TEST_P(ParallelTest, ReduceCombinesInKeyOrder)
+{
+    const auto root = ParallelBuild<UpdateStrategy>(pool_, MakeSortedInput(200));
+
+    const auto concatenated = ParallelReduce(
+        pool_,
+        *root,
+        std::string{},
+        [](const Node& node) { return std::to_string(node.Key()) + ","; },
+        [](std::string lhs, const std::string& rhs) { return lhs + rhs; });
+
+    std::string expected;
+    for (auto key = 0; key < 200; ++key) { expected += std::to_string(key) + ","; }
+    EXPECT_EQ(expected, concatenated);
+}
+
+TEST_P(ParallelTest, ReduceInRangeOfUnbalancedTree)
+{
+    const auto root = MakeTree<UpdateStrategy>(
+        std::vector<std::pair<KeyType, ValueType>>{{5, 5}, {1, 1}, {9, 9}, {3, 3}, {7, 7}, {8, 8}});
+
+    const auto sum = ParallelReduce(
+        pool_,
+        *root,
+        2,
+        9,
+        ValueType{0},
+        [](const Node& node) { return node.Value(); },
+        [](ValueType lhs, ValueType rhs) { return lhs + rhs; });
+
+    EXPECT_EQ(3 + 5 + 7 + 8, sum);
+}
+
+TEST_P(ParallelTest, SortedChunksConcatenateToSortedTree)
+{
+    const auto input = MakeSortedInput(1000);
+    const auto root = ParallelBuild<UpdateStrategy>(pool_, input);
+
+    std::vector<std::pair<KeyType, ValueType>> concatenated;
+    for (const auto& chunk : ParallelSortedChunks(pool_, *root))
+    {
+        EXPECT_FALSE(chunk.empty());
+        concatenated.insert(concatenated.end(), chunk.begin(), chunk.end());
+    }
+
+    EXPECT_EQ(input, concatenated);
+}
+
+INSTANTIATE_TEST_SUITE_P(ThreadCounts, ParallelTest, testing::Values(1, 2, 4));
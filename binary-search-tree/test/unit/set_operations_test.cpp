@@ -0,0 +1,259 @@
+#include <data-structures/binary-search-tree/bst_finger.hpp>
+#include <data-structures/binary-search-tree/bst_node.hpp>
+#include <data-structures/binary-search-tree/bst_set_operations.hpp>
+#include <data-structures/binary-search-tree/bt_update_strategies.hpp>
+
+#include "test_helpers.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using KeyType = int;
+using ValueType = std::string;
+using KeyValues = std::vector<std::pair<KeyType, ValueType>>;
+
+template <typename TNodePtr>
+KeyValues ToVector(const TNodePtr& root)
+{
+    KeyValues key_values;
+    if (!root)
+    {
+        return key_values;
+    }
+    for (auto it = root->Begin(); it != root->End(); ++it)
+    { key_values.emplace_back((*it).Key(), (*it).Value()); }
+    return key_values;
+}
+
+template <typename TUpdateStrategy = RejectUpdates<KeyType, ValueType>>
+auto MakeTestTree(const KeyValues& key_values)
+{
+    return MakeTree<TUpdateStrategy>(key_values);
+}
+
+const KeyValues kLhs = {{5, "l5"}, {2, "l2"}, {8, "l8"}, {1, "l1"}, {4, "l4"}, {9, "l9"}};
+const KeyValues kRhs = {{4, "r4"}, {7, "r7"}, {3, "r3"}, {9, "r9"}, {10, "r10"}};
+
+using Node = BSTNode<KeyType, ValueType, RejectUpdates<KeyType, ValueType>>;
+
+/// Size of the degenerate trees, deep enough to overflow the stack of recursive operations.
+constexpr KeyType kDegenerateSize = 1 << 18;
+
+/**
+ * Builds a tree of keys 0..size-1 inserted in order, which is a single chain of right children.
+ */
+Node::NodePtr MakeDegenerateTree(KeyType size)
+{
+    auto root = std::make_shared<Node>(0, ValueType());
+    BSTFinger<Node> finger(root);
+    for (KeyType key = 1; key < size; ++key) { finger.Insert(key, ValueType()); }
+    return root;
+}
+
+std::vector<KeyType> Keys(const Node::NodePtr& root)
+{
+    std::vector<KeyType> keys;
+    if (!root)
+    {
+        return keys;
+    }
+    for (auto it = root->Begin(); it != root->End(); ++it) { keys.push_back((*it).Key()); }
+    return keys;
+}
+
+std::size_t Height(const Node::NodePtr& root)
+{
+    std::size_t height = 0;
+    std::vector<std::pair<Node::NodePtr, std::size_t>> pending;
+    if (root)
+    {
+        pending.emplace_back(root, 1);
+    }
+    while (!pending.empty())
+    {
+        auto [node, depth] = std::move(pending.back());
+        pending.pop_back();
+        height = std::max(height, depth);
+        if (node->Left())
+        {
+            pending.emplace_back(node->Left(), depth + 1);
+        }
+        if (node->Right())
+        {
+            pending.emplace_back(node->Right(), depth + 1);
+        }
+    }
+    return height;
+}
+}  // namespace
+
+TEST(SetOperationsTest, SplitByExistingKey)
+{
+    auto split = Split(MakeTestTree(kLhs), 4);
+
+    EXPECT_EQ((KeyValues{{1, "l1"}, {2, "l2"}}), ToVector(split.less));
+    ASSERT_TRUE(split.equal);
+    EXPECT_EQ(4, split.equal->Key());
+    EXPECT_FALSE(split.equal->Left());
+    EXPECT_FALSE(split.equal->Right());
+    EXPECT_EQ((KeyValues{{5, "l5"}, {8, "l8"}, {9, "l9"}}), ToVector(split.greater));
+}
+
+TEST(SetOperationsTest, SplitByMissingKey)
+{
+    auto split = Split(MakeTestTree(kLhs), 6);
+
+    EXPECT_EQ((KeyValues{{1, "l1"}, {2, "l2"}, {4, "l4"}, {5, "l5"}}), ToVector(split.less));
+    EXPECT_FALSE(split.equal);
+    EXPECT_EQ((KeyValues{{8, "l8"}, {9, "l9"}}), ToVector(split.greater));
+}
+
+TEST(SetOperationsTest, SplitBeyondAllKeys)
+{
+    auto split = Split(MakeTestTree(kLhs), 100);
+
+    EXPECT_EQ(kLhs.size(), ToVector(split.less).size());
+    EXPECT_FALSE(split.equal);
+    EXPECT_FALSE(split.greater);
+}
+
+TEST(SetOperationsTest, JoinRestoresSplitTree)
+{
+    auto split = Split(MakeTestTree(kLhs), 6);
+    auto joined = Join(std::move(split.less), std::move(split.greater));
+
+    EXPECT_EQ((KeyValues{{1, "l1"}, {2, "l2"}, {4, "l4"}, {5, "l5"}, {8, "l8"}, {9, "l9"}}),
+              ToVector(joined));
+    EXPECT_TRUE(joined->Find(4));
+    EXPECT_TRUE(joined->Find(9));
+}
+
+TEST(SetOperationsTest, JoinWithEmptyTree)
+{
+    using Node = BSTNode<KeyType, ValueType, RejectUpdates<KeyType, ValueType>>;
+
+    EXPECT_EQ(kLhs.size(), ToVector(Join(MakeTestTree(kLhs), Node::NodePtr{})).size());
+    EXPECT_EQ(kLhs.size(), ToVector(Join(Node::NodePtr{}, MakeTestTree(kLhs))).size());
+}
+
+TEST(SetOperationsTest, UnionRejectingUpdatesKeepsLhsValues)
+{
+    auto united = Union(MakeTestTree(kLhs), MakeTestTree(kRhs));
+
+    EXPECT_EQ((KeyValues{{1, "l1"},
+                         {2, "l2"},
+                         {3, "r3"},
+                         {4, "l4"},
+                         {5, "l5"},
+                         {7, "r7"},
+                         {8, "l8"},
+                         {9, "l9"},
+                         {10, "r10"}}),
+              ToVector(united));
+}
+
+TEST(SetOperationsTest, UnionAcceptingUpdatesTakesRhsValues)
+{
+    using UpdateStrategy = AcceptUpdates<KeyType, ValueType>;
+    auto united = Union(MakeTestTree<UpdateStrategy>(kLhs), MakeTestTree<UpdateStrategy>(kRhs));
+
+    const auto values = ToVector(united);
+    EXPECT_EQ(9, values.size());
+    EXPECT_EQ("r4", united->Find(4)->Value());
+    EXPECT_EQ("r9", united->Find(9)->Value());
+    EXPECT_EQ("l5", united->Find(5)->Value());
+}
+
+TEST(SetOperationsTest, UnionMergingUpdatesCombinesValues)
+{
+    using UpdateStrategy = SumUpdates<KeyType, ValueType>;
+    auto united = Union(MakeTestTree<UpdateStrategy>(kLhs), MakeTestTree<UpdateStrategy>(kRhs));
+
+    EXPECT_EQ("l4r4", united->Find(4)->Value());
+    EXPECT_EQ("l9r9", united->Find(9)->Value());
+}
+
+TEST(SetOperationsTest, IntersectionKeepsCommonKeys)
+{
+    using UpdateStrategy = AcceptUpdates<KeyType, ValueType>;
+    auto intersection =
+        Intersection(MakeTestTree<UpdateStrategy>(kLhs), MakeTestTree<UpdateStrategy>(kRhs));
+
+    EXPECT_EQ((KeyValues{{4, "r4"}, {9, "r9"}}), ToVector(intersection));
+}
+
+TEST(SetOperationsTest, IntersectionOfDisjointTreesIsEmpty)
+{
+    auto intersection =
+        Intersection(MakeTestTree({{1, "l1"}, {2, "l2"}}), MakeTestTree({{3, "r3"}}));
+
+    EXPECT_FALSE(intersection);
+}
+
+TEST(SetOperationsTest, DifferenceRemovesRhsKeys)
+{
+    auto difference = Difference(MakeTestTree(kLhs), MakeTestTree(kRhs));
+
+    EXPECT_EQ((KeyValues{{1, "l1"}, {2, "l2"}, {5, "l5"}, {8, "l8"}}), ToVector(difference));
+}
+
+TEST(SetOperationsTest, DifferenceWithSupersetIsEmpty)
+{
+    auto difference = Difference(MakeTestTree(kRhs), MakeTestTree(kRhs));
+
+    EXPECT_FALSE(difference);
+}
+
+TEST(SetOperationsTest, SplitAndJoinDegenerateTree)
+{
+    auto tree = MakeDegenerateTree(kDegenerateSize);
+    ASSERT_EQ(static_cast<std::size_t>(kDegenerateSize), Height(tree));
+
+    auto split = Split(std::move(tree), kDegenerateSize / 2);
+    ASSERT_TRUE(split.equal);
+    EXPECT_EQ(kDegenerateSize / 2, split.equal->Key());
+    EXPECT_EQ(static_cast<std::size_t>(kDegenerateSize / 2), Keys(split.less).size());
+    EXPECT_EQ(static_cast<std::size_t>(kDegenerateSize / 2 - 1), Keys(split.greater).size());
+
+    auto joined = Join(Join(std::move(split.less), std::move(split.equal)),
+                       std::move(split.greater));
+    const auto keys = Keys(joined);
+    ASSERT_EQ(static_cast<std::size_t>(kDegenerateSize), keys.size());
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+}
+
+TEST(SetOperationsTest, SetOperationsOnDegenerateTree)
+{
+    const KeyValues small = {{kDegenerateSize / 2, ""}, {-1, ""}, {10, ""}, {kDegenerateSize, ""}};
+
+    auto united = Union(MakeDegenerateTree(kDegenerateSize), MakeTestTree(small));
+    EXPECT_EQ(static_cast<std::size_t>(kDegenerateSize + 2), Keys(united).size());
+
+    auto intersection = Intersection(MakeDegenerateTree(kDegenerateSize), MakeTestTree(small));
+    EXPECT_EQ((std::vector<KeyType>{10, kDegenerateSize / 2}), Keys(intersection));
+
+    auto difference = Difference(MakeDegenerateTree(kDegenerateSize), MakeTestTree(small));
+    const auto keys = Keys(difference);
+    EXPECT_EQ(static_cast<std::size_t>(kDegenerateSize - 2), keys.size());
+    EXPECT_FALSE(std::binary_search(keys.begin(), keys.end(), 10));
+    EXPECT_FALSE(std::binary_search(keys.begin(), keys.end(), kDegenerateSize / 2));
+}
+
+TEST(SetOperationsTest, BalanceDegenerateTree)
+{
+    auto balanced = Balance(MakeDegenerateTree(kDegenerateSize));
+
+    // A complete tree of 2^18 nodes needs 19 levels.
+    EXPECT_EQ(19u, Height(balanced));
+    const auto keys = Keys(balanced);
+    ASSERT_EQ(static_cast<std::size_t>(kDegenerateSize), keys.size());
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+    EXPECT_FALSE(Balance(Node::NodePtr()));
+}
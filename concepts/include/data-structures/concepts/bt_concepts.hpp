@@ -18,4 +18,8 @@ concept CallableWithUpdateSignature = requires
                                    TNode&&>;
 };
 
+template <typename TMergeOperator, typename TValue>
+concept MergeOperatorFor = std::default_initializable<TMergeOperator>
+                           && std::is_invocable_v<TMergeOperator, TValue&, TValue&&>;
+
 #endif  // BINARY_SEARCH_TREE_BT_CONCEPTS_HPP
@@ -28,6 +28,16 @@ using TWrongArgsLvalueSource = TTestCallable<CorrectReturnType, NodeWithAPtr&, N
 using TWrongArgsWrongTarget = TTestCallable<CorrectReturnType, NodeWithAPtr*, NodeWithAPtr&&>;
 using TWrongArgsOneArg = TTestCallable<CorrectReturnType, NodeWithAPtr&>;
 using TWrongReturnType = TTestCallable<int, NodeWithAPtr&, NodeWithAPtr&&>;
+
+using TMergeOperator = TTestCallable<void, int&, int&&>;
+using TMergeOperatorLvalueUpdate = TTestCallable<void, int&, int&>;
+
+struct NotDefaultConstructibleMergeOperator
+{
+    explicit NotDefaultConstructibleMergeOperator(int) {}
+
+    void operator()(int&, int&&) {}
+};
 }  // namespace
 
 static_assert(CallableWithUpdateSignature<TCallableWithUpdateSignature, NodeWithAPtr>);
@@ -35,3 +45,7 @@ static_assert(not CallableWithUpdateSignature<TWrongArgsLvalueSource, NodeWithAP
 static_assert(not CallableWithUpdateSignature<TWrongArgsWrongTarget, NodeWithAPtr>);
 static_assert(not CallableWithUpdateSignature<TWrongArgsOneArg, NodeWithAPtr>);
 static_assert(not CallableWithUpdateSignature<TWrongReturnType, NodeWithAPtr>);
+
+static_assert(MergeOperatorFor<TMergeOperator, int>);
+static_assert(not MergeOperatorFor<TMergeOperatorLvalueUpdate, int>);
+static_assert(not MergeOperatorFor<NotDefaultConstructibleMergeOperator, int>);
@@ -0,0 +1,157 @@
+#ifndef DATA_STRUCTURES_BOUNDED_QUEUE_HPP
+#define DATA_STRUCTURES_BOUNDED_QUEUE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+/**
+ * Lock-free bounded FIFO queue for any number of producers and consumers, backed by a ring buffer.
+ *
+ * Every cell of the ring carries a sequence number that tells whose turn it is: a producer may
+ * fill the cell when the sequence equals its position, and a consumer may empty it when the
+ * sequence is one past its position. Producers and consumers therefore only contend on the
+ * position they claim, and a full or empty queue is detected without locking.
+ */
+template <typename T>
+class BoundedQueue
+{
+public:
+    /**
+     * @param capacity Minimum number of elements the queue holds, rounded up to a power of two.
+     */
+    explicit BoundedQueue(std::size_t capacity)
+        : mask_(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1),
+          cells_(std::make_unique<Cell[]>(mask_ + 1))
+    {
+        for (std::size_t index = 0; index <= mask_; ++index)
+        { cells_[index].sequence.store(index, std::memory_order_relaxed); }
+    }
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    /**
+     * Appends value unless the queue is full.
+     * @return true if value was appended, false if the queue is full, in which case value is not
+     * moved from.
+     */
+    template <typename U>
+    bool TryPush(U&& value);
+
+    /**
+     * Removes the oldest element, unless the queue is empty.
+     */
+    std::optional<T> TryPop();
+
+    std::size_t Capacity() const
+    {
+        return mask_ + 1;
+    }
+
+    /**
+     * @return Whether the queue was empty at some point during the call.
+     */
+    bool Empty() const
+    {
+        const auto position = dequeue_position_.load(std::memory_order_acquire);
+        const auto sequence = cells_[position & mask_].sequence.load(std::memory_order_acquire);
+        return sequence != position + 1;
+    }
+
+    /**
+     * @return Whether the queue was full at some point during the call.
+     */
+    bool Full() const
+    {
+        const auto position = enqueue_position_.load(std::memory_order_acquire);
+        const auto sequence = cells_[position & mask_].sequence.load(std::memory_order_acquire);
+        return sequence != position;
+    }
+
+private:
+    // Keeps the positions written by producers and by consumers on different cache lines.
+    static constexpr std::size_t kCacheLineSize = 64;
+
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        std::optional<T> value;
+    };
+
+    const std::size_t mask_;
+    const std::unique_ptr<Cell[]> cells_;
+
+    alignas(kCacheLineSize) std::atomic<std::size_t> enqueue_position_{0};
+    alignas(kCacheLineSize) std::atomic<std::size_t> dequeue_position_{0};
+};
+
+template <typename T>
+template <typename U>
+bool BoundedQueue<T>::TryPush(U&& value)
+{
+    auto position = enqueue_position_.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        auto& cell = cells_[position & mask_];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto turn = static_cast<std::ptrdiff_t>(sequence - position);
+        if (turn == 0)
+        {
+            if (enqueue_position_.compare_exchange_weak(
+                    position, position + 1, std::memory_order_relaxed))
+            {
+                cell.value.emplace(std::forward<U>(value));
+                cell.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (turn < 0)
+        {
+            // The cell still holds the element pushed one lap ago.
+            return false;
+        }
+        else
+        {
+            position = enqueue_position_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+std::optional<T> BoundedQueue<T>::TryPop()
+{
+    auto position = dequeue_position_.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        auto& cell = cells_[position & mask_];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto turn = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+        if (turn == 0)
+        {
+            if (dequeue_position_.compare_exchange_weak(
+                    position, position + 1, std::memory_order_relaxed))
+            {
+                std::optional<T> value(std::move(cell.value));
+                cell.value.reset();
+                // Hands the cell to the producer of the next lap.
+                cell.sequence.store(position + mask_ + 1, std::memory_order_release);
+                return value;
+            }
+        }
+        else if (turn < 0)
+        {
+            return std::nullopt;
+        }
+        else
+        {
+            position = dequeue_position_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+#endif  // DATA_STRUCTURES_BOUNDED_QUEUE_HPP
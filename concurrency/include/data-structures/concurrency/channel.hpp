@@ -0,0 +1,290 @@
+#ifndef DATA_STRUCTURES_CHANNEL_HPP
+#define DATA_STRUCTURES_CHANNEL_HPP
+
+#include "bounded_queue.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+ * What Channel::Send does when the channel is full.
+ */
+enum class Backpressure : std::uint8_t
+{
+    /// Drops the value and counts it in ChannelStats::dropped.
+    kDrop,
+    /// Blocks the sender until a receiver makes room or the channel is closed.
+    kBlock,
+    /// Appends the value to an unbounded overflow list, delivered after the values in the ring.
+    kSpill
+};
+
+struct ChannelStats
+{
+    std::uint64_t sent = 0;
+    std::uint64_t received = 0;
+    std::uint64_t dropped = 0;
+    std::uint64_t spilled = 0;
+    /// Times a receiver waiting on an empty channel was woken up.
+    std::uint64_t receiver_wakeups = 0;
+    /// Times a sender blocked on a full channel.
+    std::uint64_t sender_stalls = 0;
+};
+
+/**
+ * Bounded channel from senders to receivers, backed by a lock-free BoundedQueue.
+ *
+ * Receivers take values in batches, and a receiver that finds the channel empty goes to sleep.
+ * Senders only wake up a receiver that is asleep, so a receiver that keeps up with the senders
+ * costs them no system calls, and one that falls behind is woken up once per batch it drains
+ * rather than once per value.
+ */
+template <typename T>
+class Channel
+{
+public:
+    /**
+     * @param capacity Minimum number of values the ring holds, see BoundedQueue.
+     * @param backpressure What Send does when the ring is full.
+     */
+    explicit Channel(std::size_t capacity, Backpressure backpressure = Backpressure::kDrop)
+        : queue_(capacity), backpressure_(backpressure)
+    {}
+
+    /**
+     * Sends value, unless the channel is closed, or it is full and drops values.
+     * @return true if value was sent.
+     * @note With Backpressure::kSpill, values sent from one thread are received in order as long
+     * as a single thread sends at a time.
+     */
+    bool Send(T value);
+
+    /**
+     * Appends up to max_values values to values without blocking.
+     * @return Number of values received.
+     */
+    std::size_t TryReceive(std::vector<T>& values, std::size_t max_values);
+
+    /**
+     * Appends up to max_values values to values, blocking until there is at least one, or the
+     * channel is closed.
+     * @return Number of values received, which is zero only once the channel is closed and empty.
+     */
+    std::size_t Receive(std::vector<T>& values, std::size_t max_values);
+
+    /**
+     * Closes the channel. Later sends fail, and blocked senders and receivers are woken up.
+     * Values already sent can still be received.
+     */
+    void Close();
+
+    bool Closed() const
+    {
+        return closed_.load(std::memory_order_acquire);
+    }
+
+    std::size_t Capacity() const
+    {
+        return queue_.Capacity();
+    }
+
+    ChannelStats Stats() const
+    {
+        return {sent_.load(std::memory_order_relaxed),
+                received_.load(std::memory_order_relaxed),
+                dropped_.load(std::memory_order_relaxed),
+                spilled_.load(std::memory_order_relaxed),
+                receiver_wakeups_.load(std::memory_order_relaxed),
+                sender_stalls_.load(std::memory_order_relaxed)};
+    }
+
+private:
+    /**
+     * One side of the channel going to sleep until the other one signals it.
+     *
+     * The sleeper announces itself before checking its condition for the last time, and the
+     * signaller changes the condition before checking for sleepers, with a full fence on both
+     * sides, so either the sleeper sees the change or the signaller sees the sleeper.
+     */
+    class Sleeper
+    {
+    public:
+        /**
+         * Sleeps unless ready() returns true after announcing the sleep.
+         * @return Whether the caller slept.
+         */
+        template <typename TReady>
+        bool SleepUnless(TReady ready)
+        {
+            const auto epoch = epoch_.load(std::memory_order_acquire);
+            sleepers_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const auto sleep = !ready();
+            if (sleep)
+            {
+                epoch_.wait(epoch, std::memory_order_acquire);
+            }
+            sleepers_.fetch_sub(1, std::memory_order_relaxed);
+            return sleep;
+        }
+
+        void Signal()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (sleepers_.load(std::memory_order_relaxed) > 0)
+            {
+                epoch_.fetch_add(1, std::memory_order_release);
+                epoch_.notify_all();
+            }
+        }
+
+    private:
+        std::atomic<std::uint32_t> sleepers_{0};
+        std::atomic<std::uint32_t> epoch_{0};
+    };
+
+    bool HasValues() const
+    {
+        return !queue_.Empty() || spill_pending_.load(std::memory_order_acquire);
+    }
+
+    BoundedQueue<T> queue_;
+    const Backpressure backpressure_;
+    std::atomic<bool> closed_{false};
+
+    std::mutex spill_mutex_;
+    std::deque<T> spill_;
+    /// Whether spill_ is not empty, in which case senders append to it rather than to the ring.
+    std::atomic<bool> spill_pending_{false};
+
+    Sleeper receivers_;
+    Sleeper senders_;
+
+    std::atomic<std::uint64_t> sent_{0};
+    std::atomic<std::uint64_t> received_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+    std::atomic<std::uint64_t> spilled_{0};
+    std::atomic<std::uint64_t> receiver_wakeups_{0};
+    std::atomic<std::uint64_t> sender_stalls_{0};
+};
+
+template <typename T>
+bool Channel<T>::Send(T value)
+{
+    if (Closed())
+    {
+        return false;
+    }
+
+    const auto spill = [&] {
+        std::lock_guard lock(spill_mutex_);
+        spill_.push_back(std::move(value));
+        spill_pending_.store(true, std::memory_order_release);
+        spilled_.fetch_add(1, std::memory_order_relaxed);
+    };
+
+    if (backpressure_ == Backpressure::kSpill && spill_pending_.load(std::memory_order_acquire))
+    {
+        // Once values spill, later ones follow them until the receivers drain the spill.
+        spill();
+    }
+    else
+    {
+        while (!queue_.TryPush(std::move(value)))
+        {
+            if (backpressure_ == Backpressure::kDrop)
+            {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (backpressure_ == Backpressure::kSpill)
+            {
+                spill();
+                break;
+            }
+            if (senders_.SleepUnless([&] { return Closed() || !queue_.Full(); }))
+            {
+                sender_stalls_.fetch_add(1, std::memory_order_relaxed);
+            }
+            if (Closed())
+            {
+                return false;
+            }
+        }
+    }
+
+    sent_.fetch_add(1, std::memory_order_relaxed);
+    receivers_.Signal();
+    return true;
+}
+
+template <typename T>
+std::size_t Channel<T>::TryReceive(std::vector<T>& values, std::size_t max_values)
+{
+    std::size_t count = 0;
+    for (; count < max_values; ++count)
+    {
+        auto value = queue_.TryPop();
+        if (!value)
+        {
+            break;
+        }
+        values.push_back(std::move(*value));
+    }
+
+    // The ring holds no values newer than the spill, so the spill is only taken once the ring is
+    // drained.
+    if (count < max_values && spill_pending_.load(std::memory_order_acquire))
+    {
+        std::lock_guard lock(spill_mutex_);
+        for (; count < max_values && !spill_.empty(); ++count)
+        {
+            values.push_back(std::move(spill_.front()));
+            spill_.pop_front();
+        }
+        spill_pending_.store(!spill_.empty(), std::memory_order_release);
+    }
+
+    if (count > 0)
+    {
+        received_.fetch_add(count, std::memory_order_relaxed);
+        senders_.Signal();
+    }
+    return count;
+}
+
+template <typename T>
+std::size_t Channel<T>::Receive(std::vector<T>& values, std::size_t max_values)
+{
+    for (;;)
+    {
+        if (const auto count = TryReceive(values, max_values); count > 0 || max_values == 0)
+        {
+            return count;
+        }
+        if (Closed())
+        {
+            // Values sent before the channel was closed may have landed after the last attempt.
+            return TryReceive(values, max_values);
+        }
+        if (receivers_.SleepUnless([&] { return Closed() || HasValues(); }))
+        {
+            receiver_wakeups_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+void Channel<T>::Close()
+{
+    closed_.store(true, std::memory_order_release);
+    receivers_.Signal();
+    senders_.Signal();
+}
+
+#endif  // DATA_STRUCTURES_CHANNEL_HPP
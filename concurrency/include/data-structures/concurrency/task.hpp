@@ -0,0 +1,304 @@
+#ifndef DATA_STRUCTURES_TASK_HPP
+#define DATA_STRUCTURES_TASK_HPP
+
+#include "work_stealing_thread_pool.hpp"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <latch>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace task_detail
+{
+template <typename T>
+class Promise;
+}  // namespace task_detail
+
+/**
+ * Lazily started coroutine that produces a T. The coroutine starts when the task is awaited, and
+ * resumes its awaiter when it finishes, on the thread it finishes on.
+ */
+template <typename T = void>
+class [[nodiscard]] Task
+{
+public:
+    using promise_type = task_detail::Promise<T>;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    explicit Task(Handle handle) : handle_(handle) {}
+
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (handle_)
+            {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    ~Task()
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) noexcept
+    {
+        handle_.promise().continuation = awaiter;
+        return handle_;
+    }
+
+    T await_resume()
+    {
+        return handle_.promise().Result();
+    }
+
+private:
+    Handle handle_;
+};
+
+namespace task_detail
+{
+class PromiseBase
+{
+public:
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        template <typename TPromise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> handle) noexcept
+        {
+            // Transferring control instead of resuming keeps chains of tasks off the stack.
+            const auto continuation = handle.promise().continuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_always initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    FinalAwaiter final_suspend() const noexcept
+    {
+        return {};
+    }
+
+    void unhandled_exception()
+    {
+        exception_ = std::current_exception();
+    }
+
+    std::coroutine_handle<> continuation;
+
+protected:
+    void RethrowIfFailed() const
+    {
+        if (exception_)
+        {
+            std::rethrow_exception(exception_);
+        }
+    }
+
+private:
+    std::exception_ptr exception_;
+};
+
+template <typename T>
+class Promise : public PromiseBase
+{
+public:
+    Task<T> get_return_object()
+    {
+        return Task<T>(std::coroutine_handle<Promise>::from_promise(*this));
+    }
+
+    template <typename TValue>
+    void return_value(TValue&& value)
+    {
+        value_.emplace(std::forward<TValue>(value));
+    }
+
+    T Result()
+    {
+        RethrowIfFailed();
+        return std::move(*value_);
+    }
+
+private:
+    std::optional<T> value_;
+};
+
+template <>
+class Promise<void> : public PromiseBase
+{
+public:
+    Task<void> get_return_object()
+    {
+        return Task<void>(std::coroutine_handle<Promise>::from_promise(*this));
+    }
+
+    void return_void() {}
+
+    void Result()
+    {
+        RethrowIfFailed();
+    }
+};
+
+/**
+ * Eagerly started coroutine that destroys itself when it finishes.
+ */
+struct Detached
+{
+    struct promise_type
+    {
+        Detached get_return_object() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void return_void() const noexcept {}
+
+        void unhandled_exception() const noexcept
+        {
+            std::terminate();
+        }
+    };
+};
+
+template <typename T>
+Detached RunAndCountDown(Task<T>& task,
+                         std::optional<std::conditional_t<std::is_void_v<T>, char, T>>& result,
+                         std::exception_ptr& exception,
+                         std::latch& done)
+{
+    try
+    {
+        if constexpr (std::is_void_v<T>)
+        {
+            co_await task;
+            result.emplace();
+        }
+        else
+        {
+            result.emplace(co_await task);
+        }
+    }
+    catch (...)
+    {
+        exception = std::current_exception();
+    }
+    done.count_down();
+}
+}  // namespace task_detail
+
+/**
+ * Awaitable that resumes the awaiting coroutine on a worker of the pool.
+ */
+class ScheduleOn
+{
+public:
+    explicit ScheduleOn(WorkStealingThreadPool& pool) : pool_(pool) {}
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        pool_.Submit([handle] { handle.resume(); });
+    }
+
+    void await_resume() const noexcept {}
+
+private:
+    WorkStealingThreadPool& pool_;
+};
+
+/**
+ * Runs the tasks concurrently and blocks the calling thread until all of them finish.
+ * @note Must not be called from a worker of a pool the tasks need, which it would block.
+ * @note Rethrows the first exception thrown by a task, in task order, if any.
+ */
+template <typename T>
+auto SyncWaitAll(std::vector<Task<T>> tasks)
+{
+    using Result = std::conditional_t<std::is_void_v<T>, char, T>;
+    std::vector<std::optional<Result>> results(tasks.size());
+    std::vector<std::exception_ptr> exceptions(tasks.size());
+    std::latch done(static_cast<std::ptrdiff_t>(tasks.size()));
+    for (std::size_t index = 0; index < tasks.size(); ++index)
+    { task_detail::RunAndCountDown(tasks[index], results[index], exceptions[index], done); }
+    done.wait();
+
+    for (const auto& exception : exceptions)
+    {
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+    if constexpr (!std::is_void_v<T>)
+    {
+        std::vector<T> values;
+        values.reserve(results.size());
+        for (auto& result : results) { values.push_back(std::move(*result)); }
+        return values;
+    }
+}
+
+/**
+ * Runs the task and blocks the calling thread until it finishes.
+ * @return Result of the task.
+ */
+template <typename T>
+T SyncWait(Task<T> task)
+{
+    std::vector<Task<T>> tasks;
+    tasks.push_back(std::move(task));
+    if constexpr (std::is_void_v<T>)
+    {
+        SyncWaitAll(std::move(tasks));
+    }
+    else
+    {
+        return std::move(SyncWaitAll(std::move(tasks)).front());
+    }
+}
+
+#endif  // DATA_STRUCTURES_TASK_HPP
@@ -0,0 +1,317 @@
+#ifndef DATA_STRUCTURES_WORK_STEALING_THREAD_POOL_HPP
+#define DATA_STRUCTURES_WORK_STEALING_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * Fixed-size thread pool in which every worker owns a task queue.
+ *
+ * Tasks submitted from a worker go to the back of its own queue, and the worker takes its tasks
+ * back from there, newest first. Tasks submitted from other threads are spread over the queues.
+ * A worker whose queue is empty steals the oldest task from the queues of the other workers.
+ */
+class WorkStealingThreadPool
+{
+public:
+    using Task = std::function<void()>;
+
+    explicit WorkStealingThreadPool(std::size_t thread_count = std::thread::hardware_concurrency());
+
+    ~WorkStealingThreadPool();
+
+    WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+
+    /**
+     * Schedules the task for execution on one of the workers.
+     * @param task Task to execute.
+     */
+    void Submit(Task task);
+
+    /**
+     * Executes one pending task on the calling thread, if there is any.
+     * @return true if a task was executed, false otherwise.
+     */
+    bool TryRunPendingTask();
+
+    /**
+     * Executes pending tasks on the calling thread until done() returns true, sleeping while there
+     * are none. Whoever makes done() return true must call NotifyWaiters() afterwards.
+     */
+    template <typename TDone>
+    void RunPendingTasksUntil(TDone done);
+
+    /**
+     * Wakes up the threads sleeping in RunPendingTasksUntil, so that they check their condition.
+     */
+    void NotifyWaiters();
+
+    std::size_t ThreadCount() const
+    {
+        return workers_.size();
+    }
+
+private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void WorkerLoop(std::size_t index);
+
+    /**
+     * Takes the newest task from the queue at index, or steals the oldest task from another queue.
+     */
+    std::optional<Task> TryPop(std::size_t index);
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> workers_;
+
+    /// Number of tasks in the queues. Changed under the lock of the queue the task is pushed to or
+    /// popped from, so it never counts a task that is not in a queue yet.
+    std::atomic<std::size_t> pending_{0};
+    std::atomic<std::size_t> next_queue_{0};
+
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_up_;
+    bool stopping_ = false;
+
+    static inline thread_local const WorkStealingThreadPool* current_pool_ = nullptr;
+    static inline thread_local std::size_t current_index_ = 0;
+};
+
+/**
+ * Set of tasks executed on a thread pool that can be waited for together.
+ */
+class TaskGroup
+{
+public:
+    using Task = WorkStealingThreadPool::Task;
+
+    explicit TaskGroup(WorkStealingThreadPool& pool) : pool_(pool) {}
+
+    /**
+     * Waits for the outstanding tasks. Exceptions thrown by the tasks are discarded.
+     */
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /**
+     * Schedules the task for execution on the pool.
+     * @param task Task to execute.
+     */
+    void Run(Task task);
+
+    /**
+     * Waits until all the tasks in the group finish. The calling thread executes pending tasks of
+     * the pool in the meantime, so that groups can be waited for from within tasks, and sleeps
+     * while there are none.
+     * @note Rethrows the first exception thrown by a task of the group, if any.
+     */
+    void Wait();
+
+private:
+    void WaitForOutstanding();
+
+    WorkStealingThreadPool& pool_;
+    std::atomic<std::size_t> outstanding_{0};
+
+    std::mutex exception_mutex_;
+    std::exception_ptr exception_;
+};
+
+inline WorkStealingThreadPool::WorkStealingThreadPool(std::size_t thread_count)
+{
+    thread_count = std::max<std::size_t>(thread_count, 1);
+    for (std::size_t index = 0; index < thread_count; ++index)
+    { queues_.push_back(std::make_unique<Queue>()); }
+    for (std::size_t index = 0; index < thread_count; ++index)
+    {
+        workers_.emplace_back([this, index] { WorkerLoop(index); });
+    }
+}
+
+inline WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    {
+        std::lock_guard lock(sleep_mutex_);
+        stopping_ = true;
+    }
+    wake_up_.notify_all();
+    for (auto& worker : workers_) { worker.join(); }
+}
+
+inline void WorkStealingThreadPool::Submit(Task task)
+{
+    const auto index = current_pool_ == this
+                           ? current_index_
+                           : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    {
+        std::lock_guard lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(std::move(task));
+        pending_.fetch_add(1);
+    }
+
+    // Taking the lock orders the increment before the predicate check of a worker going to sleep.
+    {
+        std::lock_guard lock(sleep_mutex_);
+    }
+    wake_up_.notify_one();
+}
+
+inline bool WorkStealingThreadPool::TryRunPendingTask()
+{
+    const auto index = current_pool_ == this
+                           ? current_index_
+                           : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    auto task = TryPop(index);
+    if (!task)
+    {
+        return false;
+    }
+    (*task)();
+    return true;
+}
+
+template <typename TDone>
+void WorkStealingThreadPool::RunPendingTasksUntil(TDone done)
+{
+    while (!done())
+    {
+        if (TryRunPendingTask())
+        {
+            continue;
+        }
+        std::unique_lock lock(sleep_mutex_);
+        wake_up_.wait(lock, [this, &done] { return done() || pending_.load() > 0; });
+    }
+}
+
+inline void WorkStealingThreadPool::NotifyWaiters()
+{
+    {
+        std::lock_guard lock(sleep_mutex_);
+    }
+    wake_up_.notify_all();
+}
+
+inline void WorkStealingThreadPool::WorkerLoop(std::size_t index)
+{
+    current_pool_ = this;
+    current_index_ = index;
+
+    while (true)
+    {
+        if (auto task = TryPop(index))
+        {
+            (*task)();
+            continue;
+        }
+
+        std::unique_lock lock(sleep_mutex_);
+        wake_up_.wait(lock, [this] { return stopping_ || pending_.load() > 0; });
+        if (stopping_ && pending_.load() == 0)
+        {
+            return;
+        }
+    }
+}
+
+inline std::optional<WorkStealingThreadPool::Task> WorkStealingThreadPool::TryPop(
+    std::size_t index)
+{
+    if (pending_.load() == 0)
+    {
+        return std::nullopt;
+    }
+
+    {
+        auto& own = *queues_[index];
+        std::lock_guard lock(own.mutex);
+        if (!own.tasks.empty())
+        {
+            auto task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            pending_.fetch_sub(1);
+            return task;
+        }
+    }
+
+    for (std::size_t offset = 1; offset < queues_.size(); ++offset)
+    {
+        auto& victim = *queues_[(index + offset) % queues_.size()];
+        std::lock_guard lock(victim.mutex);
+        if (!victim.tasks.empty())
+        {
+            auto task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            pending_.fetch_sub(1);
+            return task;
+        }
+    }
+
+    return std::nullopt;
+}
+
+inline TaskGroup::~TaskGroup()
+{
+    WaitForOutstanding();
+}
+
+inline void TaskGroup::Run(Task task)
+{
+    outstanding_.fetch_add(1);
+    pool_.Submit([this, pool = &pool_, task = std::move(task)] {
+        try
+        {
+            task();
+        }
+        catch (...)
+        {
+            std::lock_guard lock(exception_mutex_);
+            if (!exception_)
+            {
+                exception_ = std::current_exception();
+            }
+        }
+        // The group may be destroyed as soon as the last task is accounted for, so the waiter is
+        // woken up through the pool.
+        if (outstanding_.fetch_sub(1) == 1)
+        {
+            pool->NotifyWaiters();
+        }
+    });
+}
+
+inline void TaskGroup::Wait()
+{
+    WaitForOutstanding();
+
+    std::lock_guard lock(exception_mutex_);
+    if (exception_)
+    {
+        std::rethrow_exception(std::exchange(exception_, nullptr));
+    }
+}
+
+inline void TaskGroup::WaitForOutstanding()
+{
+    pool_.RunPendingTasksUntil([this] { return outstanding_.load() == 0; });
+}
+
+#endif  // DATA_STRUCTURES_WORK_STEALING_THREAD_POOL_HPP
@@ -0,0 +1,132 @@
+#include <data-structures/concurrency/bounded_queue.hpp>
+#include <data-structures/concurrency/channel.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+TEST(BoundedQueueTest, FifoUpToCapacity)
+{
+    BoundedQueue<std::unique_ptr<int>> queue(3);
+    EXPECT_EQ(queue.Capacity(), 4u);
+    EXPECT_TRUE(queue.Empty());
+
+    for (auto value = 0; value < 4; ++value)
+    { EXPECT_TRUE(queue.TryPush(std::make_unique<int>(value))); }
+    EXPECT_TRUE(queue.Full());
+
+    auto rejected = std::make_unique<int>(4);
+    EXPECT_FALSE(queue.TryPush(std::move(rejected)));
+    ASSERT_NE(rejected, nullptr) << "A rejected value must not be moved from";
+
+    for (auto value = 0; value < 4; ++value) { EXPECT_EQ(**queue.TryPop(), value); }
+    EXPECT_EQ(queue.TryPop(), std::nullopt);
+    EXPECT_TRUE(queue.TryPush(std::move(rejected)));
+    EXPECT_EQ(**queue.TryPop(), 4);
+}
+
+TEST(BoundedQueueTest, ConcurrentProducersAndConsumers)
+{
+    constexpr auto kProducers = 4;
+    constexpr auto kValues = 10000;
+    BoundedQueue<int> queue(64);
+    std::vector<long> sums(kProducers, 0);
+
+    std::vector<std::thread> threads;
+    for (auto producer = 0; producer < kProducers; ++producer)
+    {
+        threads.emplace_back([&queue] {
+            for (auto value = 1; value <= kValues;)
+            {
+                if (queue.TryPush(value))
+                {
+                    ++value;
+                    continue;
+                }
+                std::this_thread::yield();
+            }
+        });
+        threads.emplace_back([&queue, &sum = sums[producer]] {
+            for (auto popped = 0; popped < kValues;)
+            {
+                if (const auto value = queue.TryPop())
+                {
+                    sum += *value;
+                    ++popped;
+                    continue;
+                }
+                std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+
+    EXPECT_EQ(std::accumulate(sums.begin(), sums.end(), 0L),
+              kProducers * (kValues * (kValues + 1L) / 2));
+}
+
+TEST(ChannelTest, DropsWhenFull)
+{
+    Channel<int> channel(2, Backpressure::kDrop);
+    EXPECT_TRUE(channel.Send(1));
+    EXPECT_TRUE(channel.Send(2));
+    EXPECT_FALSE(channel.Send(3));
+
+    std::vector<int> values;
+    EXPECT_EQ(channel.TryReceive(values, 10), 2u);
+    EXPECT_EQ(values, (std::vector<int>{1, 2}));
+    EXPECT_EQ(channel.Stats().dropped, 1u);
+    EXPECT_EQ(channel.Stats().received, 2u);
+}
+
+TEST(ChannelTest, SpillsInOrder)
+{
+    Channel<int> channel(2, Backpressure::kSpill);
+    for (auto value = 0; value < 5; ++value) { EXPECT_TRUE(channel.Send(value)); }
+    EXPECT_EQ(channel.Stats().spilled, 3u);
+
+    std::vector<int> values;
+    EXPECT_EQ(channel.TryReceive(values, 3), 3u);
+    // The spill is not drained yet, so the next value follows it rather than entering the ring.
+    EXPECT_TRUE(channel.Send(5));
+    EXPECT_EQ(channel.TryReceive(values, 10), 3u);
+    EXPECT_EQ(values, (std::vector<int>{0, 1, 2, 3, 4, 5}));
+
+    EXPECT_TRUE(channel.Send(6));
+    EXPECT_EQ(channel.Stats().spilled, 4u);
+}
+
+TEST(ChannelTest, BlocksUntilReceiverCatchesUp)
+{
+    constexpr auto kValues = 10000;
+    Channel<int> channel(4, Backpressure::kBlock);
+
+    std::thread sender([&channel] {
+        for (auto value = 0; value < kValues; ++value) { channel.Send(value); }
+        channel.Close();
+    });
+
+    std::vector<int> values;
+    while (channel.Receive(values, 3) > 0) {}
+    sender.join();
+
+    std::vector<int> expected(kValues);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(values, expected);
+    EXPECT_EQ(channel.Stats().dropped, 0u);
+}
+
+TEST(ChannelTest, CloseWakesReceiverAndRejectsSends)
+{
+    Channel<int> channel(4);
+    std::vector<int> values;
+    std::thread receiver([&] { EXPECT_EQ(channel.Receive(values, 10), 0u); });
+    channel.Close();
+    receiver.join();
+
+    EXPECT_TRUE(channel.Closed());
+    EXPECT_FALSE(channel.Send(1));
+}
@@ -0,0 +1,99 @@
+#include <data-structures/concurrency/task.hpp>
+#include <data-structures/concurrency/work_stealing_thread_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+Task<int> Square(int value)
+{
+    co_return value * value;
+}
+
+Task<int> SumOfSquares(int count)
+{
+    auto sum = 0;
+    for (auto value = 0; value < count; ++value) { sum += co_await Square(value); }
+    co_return sum;
+}
+
+Task<std::thread::id> WorkerId(WorkStealingThreadPool& pool)
+{
+    co_await ScheduleOn(pool);
+    co_return std::this_thread::get_id();
+}
+
+Task<> Throw()
+{
+    throw std::runtime_error("failed");
+    co_return;
+}
+}  // namespace
+
+TEST(TaskTest, IsLazyAndReturnsValue)
+{
+    auto started = false;
+    auto task = [](bool& started) -> Task<std::string> {
+        started = true;
+        co_return "done";
+    }(started);
+    EXPECT_FALSE(started);
+    EXPECT_EQ(SyncWait(std::move(task)), "done");
+    EXPECT_TRUE(started);
+}
+
+TEST(TaskTest, AwaitsNestedTasks)
+{
+    EXPECT_EQ(SyncWait(SumOfSquares(4)), 0 + 1 + 4 + 9);
+}
+
+TEST(TaskTest, ScheduleOnResumesOnPoolWorker)
+{
+    WorkStealingThreadPool pool(2);
+    EXPECT_NE(SyncWait(WorkerId(pool)), std::this_thread::get_id());
+}
+
+TEST(TaskTest, SyncWaitAllRunsTasksConcurrently)
+{
+    WorkStealingThreadPool pool(4);
+    std::atomic<int> counter{0};
+    std::vector<Task<>> tasks;
+    for (auto i = 0; i < 100; ++i)
+    {
+        tasks.push_back([](WorkStealingThreadPool& pool, std::atomic<int>& counter) -> Task<> {
+            co_await ScheduleOn(pool);
+            ++counter;
+        }(pool, counter));
+    }
+    SyncWaitAll(std::move(tasks));
+    EXPECT_EQ(counter.load(), 100);
+
+    std::vector<Task<int>> squares;
+    for (auto value = 0; value < 10; ++value) { squares.push_back(Square(value)); }
+    EXPECT_EQ(SyncWaitAll(std::move(squares)),
+              (std::vector<int>{0, 1, 4, 9, 16, 25, 36, 49, 64, 81}));
+}
+
+TEST(TaskTest, PropagatesExceptions)
+{
+    EXPECT_THROW(SyncWait(Throw()), std::runtime_error);
+
+    auto caught = [](Task<> task) -> Task<bool> {
+        try
+        {
+            co_await task;
+        }
+        catch (const std::runtime_error&)
+        {
+            co_return true;
+        }
+        co_return false;
+    }(Throw());
+    EXPECT_TRUE(SyncWait(std::move(caught)));
+}
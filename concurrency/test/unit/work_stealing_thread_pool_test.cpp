@@ -0,0 +1,88 @@
+#include <data-structures/concurrency/work_stealing_thread_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+
+TEST(WorkStealingThreadPoolTest, RunsAllSubmittedTasks)
+{
+    std::atomic<int> counter{0};
+    {
+        WorkStealingThreadPool pool(4);
+        for (auto i = 0; i < 1000; ++i) { pool.Submit([&counter] { ++counter; }); }
+    }
+    EXPECT_EQ(1000, counter.load());
+}
+
+TEST(WorkStealingThreadPoolTest, TaskGroupWaitsForItsTasks)
+{
+    WorkStealingThreadPool pool(4);
+    std::atomic<int> counter{0};
+
+    TaskGroup group(pool);
+    for (auto i = 0; i < 100; ++i) { group.Run([&counter] { ++counter; }); }
+    group.Wait();
+
+    EXPECT_EQ(100, counter.load());
+}
+
+TEST(WorkStealingThreadPoolTest, TaskGroupWaitsForRunningTasks)
+{
+    WorkStealingThreadPool pool(2);
+    std::atomic<bool> started{false};
+    std::atomic<bool> finished{false};
+
+    TaskGroup group(pool);
+    group.Run([&] {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        finished = true;
+    });
+    // Once the task runs on a worker, the waiter has nothing to help with and sleeps until the
+    // task finishes.
+    while (!started.load()) { std::this_thread::yield(); }
+    group.Wait();
+
+    EXPECT_TRUE(finished.load());
+}
+
+TEST(WorkStealingThreadPoolTest, NestedTaskGroupsDoNotDeadlock)
+{
+    // A single worker has to help with the nested tasks while it waits for them.
+    WorkStealingThreadPool pool(1);
+
+    std::function<int(int)> fibonacci = [&](int n) {
+        if (n < 2)
+        {
+            return n;
+        }
+        int left = 0;
+        TaskGroup group(pool);
+        group.Run([&] { left = fibonacci(n - 1); });
+        const auto right = fibonacci(n - 2);
+        group.Wait();
+        return left + right;
+    };
+
+    int result = 0;
+    TaskGroup group(pool);
+    group.Run([&] { result = fibonacci(15); });
+    group.Wait();
+
+    EXPECT_EQ(610, result);
+}
+
+TEST(WorkStealingThreadPoolTest, TaskGroupRethrowsTaskException)
+{
+    WorkStealingThreadPool pool(2);
+
+    TaskGroup group(pool);
+    group.Run([] { throw std::runtime_error("task failed"); });
+    group.Run([] {});
+
+    EXPECT_THROW(group.Wait(), std::runtime_error);
+}
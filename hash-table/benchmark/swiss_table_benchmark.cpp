@@ -0,0 +1,181 @@
+#include <data-structures/binary-search-tree/bst_node.hpp>
+#include <data-structures/binary-search-tree/bt_update_strategies.hpp>
+#include <data-structures/hash-table/swiss_table.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t kLookups = 1 << 16;
+
+std::vector<std::int64_t> RandomIntegers(std::int64_t size)
+{
+    std::mt19937_64 random(42);
+    std::vector<std::int64_t> keys(size);
+    for (auto& key : keys) { key = static_cast<std::int64_t>(random()); }
+    return keys;
+}
+
+std::vector<std::string> RandomStrings(std::int64_t size)
+{
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> host(0, 15);
+    std::vector<std::string> keys;
+    keys.reserve(size);
+    for (std::int64_t index = 0; index < size; ++index)
+    {
+        keys.push_back("service/host-" + std::to_string(host(random)) + "/" +
+                       std::to_string(index));
+    }
+    std::shuffle(keys.begin(), keys.end(), random);
+    return keys;
+}
+
+template <typename TKey>
+std::vector<TKey> MakeKeys(std::int64_t size)
+{
+    if constexpr (std::is_same_v<TKey, std::string>)
+    {
+        return RandomStrings(size);
+    }
+    else
+    {
+        return RandomIntegers(size);
+    }
+}
+
+/**
+ * @return Key that is missing from the keys made by MakeKeys, save for unlikely collisions.
+ */
+template <typename TKey>
+TKey Missing(const TKey& key)
+{
+    if constexpr (std::is_same_v<TKey, std::string>)
+    {
+        return key + "/missing";
+    }
+    else
+    {
+        return ~key;
+    }
+}
+
+/**
+ * Lookups of keys in the table, or of keys missing from it, in random order.
+ */
+template <typename TKey>
+std::vector<TKey> SampleLookups(const std::vector<TKey>& keys, bool missing)
+{
+    std::mt19937 random(7);
+    std::uniform_int_distribution<std::size_t> index(0, keys.size() - 1);
+    std::vector<TKey> lookups;
+    lookups.reserve(kLookups);
+    for (std::size_t lookup = 0; lookup < kLookups; ++lookup)
+    {
+        const auto& key = keys[index(random)];
+        lookups.push_back(missing ? Missing(key) : key);
+    }
+    return lookups;
+}
+
+template <typename TKey>
+auto MakeBST(const std::vector<TKey>& keys)
+{
+    auto root = MakeBSTNode<RejectUpdates<TKey, int>>(keys.front(), 0);
+    for (const auto& key : keys) { root->Insert(key, 0); }
+    return root;
+}
+
+template <typename TKey>
+auto MakeSwissTable(const std::vector<TKey>& keys)
+{
+    SwissTable<TKey, int> table;
+    for (const auto& key : keys) { table.InsertOrAssign(key, 0); }
+    return table;
+}
+
+template <typename TKey>
+auto MakeUnorderedMap(const std::vector<TKey>& keys)
+{
+    std::unordered_map<TKey, int> map;
+    for (const auto& key : keys) { map.insert_or_assign(key, 0); }
+    return map;
+}
+}  // namespace
+
+template <typename TKey>
+static void BM_SwissTableInsert(benchmark::State& state)
+{
+    const auto keys = MakeKeys<TKey>(state.range(0));
+    for (auto _ : state) { benchmark::DoNotOptimize(MakeSwissTable(keys)); }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_SwissTableInsert, std::int64_t)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_SwissTableInsert, std::string)->Arg(1 << 12)->Arg(1 << 16);
+
+template <typename TKey>
+static void BM_UnorderedMapInsert(benchmark::State& state)
+{
+    const auto keys = MakeKeys<TKey>(state.range(0));
+    for (auto _ : state) { benchmark::DoNotOptimize(MakeUnorderedMap(keys)); }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_UnorderedMapInsert, std::int64_t)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_UnorderedMapInsert, std::string)->Arg(1 << 12)->Arg(1 << 16);
+
+/**
+ * Argument 1 is whether the keys looked up are missing from the table.
+ */
+template <typename TKey>
+static void BM_SwissTableFind(benchmark::State& state)
+{
+    const auto keys = MakeKeys<TKey>(state.range(0));
+    const auto table = MakeSwissTable(keys);
+    const auto lookups = SampleLookups(keys, state.range(1));
+    for (auto _ : state)
+    {
+        for (const auto& key : lookups) { benchmark::DoNotOptimize(table.Find(key)); }
+    }
+    state.SetItemsProcessed(state.iterations() * kLookups);
+}
+BENCHMARK_TEMPLATE(BM_SwissTableFind, std::int64_t)->ArgsProduct({{1 << 12, 1 << 16}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_SwissTableFind, std::string)->ArgsProduct({{1 << 12, 1 << 16}, {0, 1}});
+
+template <typename TKey>
+static void BM_UnorderedMapFind(benchmark::State& state)
+{
+    const auto keys = MakeKeys<TKey>(state.range(0));
+    const auto map = MakeUnorderedMap(keys);
+    const auto lookups = SampleLookups(keys, state.range(1));
+    for (auto _ : state)
+    {
+        for (const auto& key : lookups) { benchmark::DoNotOptimize(map.find(key)); }
+    }
+    state.SetItemsProcessed(state.iterations() * kLookups);
+}
+BENCHMARK_TEMPLATE(BM_UnorderedMapFind, std::int64_t)->ArgsProduct({{1 << 12, 1 << 16}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_UnorderedMapFind, std::string)->ArgsProduct({{1 << 12, 1 << 16}, {0, 1}});
+
+template <typename TKey>
+static void BM_BSTFind(benchmark::State& state)
+{
+    const auto keys = MakeKeys<TKey>(state.range(0));
+    const auto root = MakeBST(keys);
+    const auto lookups = SampleLookups(keys, state.range(1));
+    for (auto _ : state)
+    {
+        for (const auto& key : lookups) { benchmark::DoNotOptimize(root->Find(key)); }
+    }
+    state.SetItemsProcessed(state.iterations() * kLookups);
+}
+BENCHMARK_TEMPLATE(BM_BSTFind, std::int64_t)->ArgsProduct({{1 << 12, 1 << 16}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_BSTFind, std::string)->ArgsProduct({{1 << 12, 1 << 16}, {0, 1}});
@@ -0,0 +1,321 @@
+#ifndef DATA_STRUCTURES_SWISS_TABLE_HPP
+#define DATA_STRUCTURES_SWISS_TABLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/**
+ * Keys that THash can hash, as keys of a SwissTable.
+ */
+template <typename TKey, typename THash = std::hash<TKey>>
+concept Hashable = std::default_initializable<THash> && requires(const TKey& key) {
+    { THash{}(key) } -> std::convertible_to<std::size_t>;
+};
+
+/**
+ * Open-addressing hash map in the style of Swiss tables.
+ *
+ * Slots are arranged in groups of 16, and every slot has a control byte: either kEmpty, or the
+ * low 7 bits of the hash of the key stored in the slot. A lookup probes whole groups, comparing
+ * the 16 control bytes of a group with the hash bits of the key at once, with SSE2 instructions
+ * where available, and only compares keys in the slots whose control byte matched. Nearly all
+ * keys are therefore compared once per lookup, and a missing key usually costs a single group
+ * probe. Groups are probed quadratically, and the table doubles once it is 7/8 full.
+ *
+ * Entries cannot be erased one by one, only cleared all at once, which keeps probing free of
+ * deleted markers.
+ *
+ * @tparam TKey key type
+ * @tparam TValue value type
+ * @tparam THash hash of keys, whose result is mixed again, so that identity hashes of integers
+ * work well
+ */
+template <typename TKey, typename TValue, typename THash = std::hash<TKey>>
+class SwissTable
+{
+    static_assert(Hashable<TKey, THash>, "SwissTable needs keys that THash can hash");
+
+public:
+    using Entry = std::pair<const TKey, TValue>;
+
+    SwissTable() = default;
+
+    SwissTable(const SwissTable&) = delete;
+    SwissTable& operator=(const SwissTable&) = delete;
+
+    SwissTable(SwissTable&& other) noexcept { Swap(other); }
+
+    SwissTable& operator=(SwissTable&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            Swap(other);
+        }
+        return *this;
+    }
+
+    ~SwissTable()
+    {
+        Clear();
+    }
+
+    /**
+     * Maps key to value, replacing the value already mapped to key, if any.
+     * @return Reference to the value under key.
+     */
+    template <typename U>
+    TValue& InsertOrAssign(const TKey& key, U&& value);
+
+    /**
+     * @return Pointer to the value under key, or nullptr if there is none.
+     */
+    TValue* Find(const TKey& key);
+
+    const TValue* Find(const TKey& key) const;
+
+    std::size_t Size() const
+    {
+        return size_;
+    }
+
+    bool Empty() const
+    {
+        return size_ == 0;
+    }
+
+    /**
+     * @return Number of slots.
+     */
+    std::size_t Capacity() const
+    {
+        return group_count_ * kGroupSize;
+    }
+
+    /**
+     * @return Bytes of the slots and control bytes, not counting memory the keys and values own on
+     * the heap.
+     */
+    std::size_t MemoryBytes() const
+    {
+        return Capacity() * (sizeof(Slot) + 1);
+    }
+
+    /**
+     * Removes all entries and releases the slots.
+     */
+    void Clear();
+
+private:
+    static constexpr std::size_t kGroupSize = 16;
+    static constexpr std::uint8_t kEmpty = 0x80;
+
+    struct Slot
+    {
+        alignas(Entry) std::byte storage[sizeof(Entry)];
+
+        Entry& Get()
+        {
+            return *std::launder(reinterpret_cast<Entry*>(storage));
+        }
+
+        const Entry& Get() const
+        {
+            return *std::launder(reinterpret_cast<const Entry*>(storage));
+        }
+    };
+
+    struct Group
+    {
+        alignas(kGroupSize) std::array<std::uint8_t, kGroupSize> control;
+
+        /**
+         * @return Mask with bit i set if the control byte of slot i equals byte.
+         */
+        unsigned Match(std::uint8_t byte) const
+        {
+#ifdef __SSE2__
+            const auto bytes = _mm_load_si128(reinterpret_cast<const __m128i*>(control.data()));
+            const auto matches = _mm_cmpeq_epi8(bytes, _mm_set1_epi8(static_cast<char>(byte)));
+            return static_cast<unsigned>(_mm_movemask_epi8(matches));
+#else
+            unsigned mask = 0;
+            for (std::size_t index = 0; index < kGroupSize; ++index)
+            { mask |= static_cast<unsigned>(control[index] == byte) << index; }
+            return mask;
+#endif
+        }
+    };
+
+    /**
+     * @return Hash with the bits of THash spread over the whole word, so that both the group index
+     * taken from the high bits and the control byte taken from the low bits vary. Uses the
+     * splitmix64 finalizer, which needs only 64-bit arithmetic.
+     */
+    static std::uint64_t Hash(const TKey& key)
+    {
+        auto hash = static_cast<std::uint64_t>(THash{}(key));
+        hash ^= hash >> 30;
+        hash *= 0xBF58476D1CE4E5B9ull;
+        hash ^= hash >> 27;
+        hash *= 0x94D049BB133111EBull;
+        hash ^= hash >> 31;
+        return hash;
+    }
+
+    static std::uint8_t ControlByte(std::uint64_t hash)
+    {
+        return static_cast<std::uint8_t>(hash & 0x7F);
+    }
+
+    std::size_t FirstGroup(std::uint64_t hash) const
+    {
+        return static_cast<std::size_t>(hash >> 7) & (group_count_ - 1);
+    }
+
+    /**
+     * @return Index of the slot that holds key, or of the empty slot where key belongs.
+     */
+    std::pair<std::size_t, bool> Locate(const TKey& key, std::uint64_t hash) const;
+
+    void Grow();
+
+    void Swap(SwissTable& other) noexcept
+    {
+        std::swap(groups_, other.groups_);
+        std::swap(slots_, other.slots_);
+        std::swap(group_count_, other.group_count_);
+        std::swap(size_, other.size_);
+    }
+
+    std::unique_ptr<Group[]> groups_;
+    std::unique_ptr<Slot[]> slots_;
+    std::size_t group_count_ = 0;
+    std::size_t size_ = 0;
+};
+
+template <typename TKey, typename TValue, typename THash>
+std::pair<std::size_t, bool> SwissTable<TKey, TValue, THash>::Locate(const TKey& key,
+                                                                      std::uint64_t hash) const
+{
+    const auto control = ControlByte(hash);
+    auto group = FirstGroup(hash);
+    // Triangular steps visit every group once when the number of groups is a power of two.
+    for (std::size_t step = 1;; ++step)
+    {
+        const auto& probed = groups_[group];
+        for (auto mask = probed.Match(control); mask != 0; mask &= mask - 1)
+        {
+            const auto slot = group * kGroupSize + static_cast<std::size_t>(std::countr_zero(mask));
+            if (slots_[slot].Get().first == key)
+            {
+                return {slot, true};
+            }
+        }
+        if (const auto empty = probed.Match(kEmpty); empty != 0)
+        {
+            return {group * kGroupSize + static_cast<std::size_t>(std::countr_zero(empty)), false};
+        }
+        assert(step < group_count_ && "The table always has empty slots");
+        group = (group + step) & (group_count_ - 1);
+    }
+}
+
+template <typename TKey, typename TValue, typename THash>
+template <typename U>
+TValue& SwissTable<TKey, TValue, THash>::InsertOrAssign(const TKey& key, U&& value)
+{
+    const auto hash = Hash(key);
+    if (group_count_ > 0)
+    {
+        if (const auto [slot, found] = Locate(key, hash); found)
+        {
+            return slots_[slot].Get().second = std::forward<U>(value);
+        }
+    }
+    if ((size_ + 1) * 8 > Capacity() * 7)
+    {
+        Grow();
+    }
+
+    const auto slot = Locate(key, hash).first;
+    new (slots_[slot].storage) Entry(key, std::forward<U>(value));
+    groups_[slot / kGroupSize].control[slot % kGroupSize] = ControlByte(hash);
+    ++size_;
+    return slots_[slot].Get().second;
+}
+
+template <typename TKey, typename TValue, typename THash>
+TValue* SwissTable<TKey, TValue, THash>::Find(const TKey& key)
+{
+    return const_cast<TValue*>(std::as_const(*this).Find(key));
+}
+
+template <typename TKey, typename TValue, typename THash>
+const TValue* SwissTable<TKey, TValue, THash>::Find(const TKey& key) const
+{
+    if (size_ == 0)
+    {
+        return nullptr;
+    }
+    const auto [slot, found] = Locate(key, Hash(key));
+    return found ? &slots_[slot].Get().second : nullptr;
+}
+
+template <typename TKey, typename TValue, typename THash>
+void SwissTable<TKey, TValue, THash>::Clear()
+{
+    for (std::size_t slot = 0; size_ > 0 && slot < Capacity(); ++slot)
+    {
+        if (groups_[slot / kGroupSize].control[slot % kGroupSize] != kEmpty)
+        {
+            slots_[slot].Get().~Entry();
+            --size_;
+        }
+    }
+    groups_.reset();
+    slots_.reset();
+    group_count_ = 0;
+}
+
+template <typename TKey, typename TValue, typename THash>
+void SwissTable<TKey, TValue, THash>::Grow()
+{
+    SwissTable grown;
+    grown.group_count_ = std::max<std::size_t>(group_count_ * 2, 1);
+    grown.groups_ = std::make_unique<Group[]>(grown.group_count_);
+    grown.slots_ = std::make_unique<Slot[]>(grown.Capacity());
+    for (std::size_t group = 0; group < grown.group_count_; ++group)
+    { grown.groups_[group].control.fill(kEmpty); }
+
+    for (std::size_t slot = 0; slot < Capacity(); ++slot)
+    {
+        if (groups_[slot / kGroupSize].control[slot % kGroupSize] == kEmpty)
+        {
+            continue;
+        }
+        auto& entry = slots_[slot].Get();
+        const auto hash = Hash(entry.first);
+        const auto target = grown.Locate(entry.first, hash).first;
+        new (grown.slots_[target].storage) Entry(entry.first, std::move(entry.second));
+        grown.groups_[target / kGroupSize].control[target % kGroupSize] = ControlByte(hash);
+        ++grown.size_;
+    }
+    Clear();
+    Swap(grown);
+}
+
+#endif  // DATA_STRUCTURES_SWISS_TABLE_HPP
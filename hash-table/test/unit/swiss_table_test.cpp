@@ -0,0 +1,121 @@
+#include <data-structures/hash-table/swiss_table.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+/**
+ * Hash that sends every key to the same group, so that lookups have to probe past full groups.
+ */
+struct CollidingHash
+{
+    std::size_t operator()(std::int64_t) const
+    {
+        return 0;
+    }
+};
+}  // namespace
+
+TEST(SwissTableTest, EmptyTable)
+{
+    SwissTable<std::int64_t, int> table;
+    EXPECT_TRUE(table.Empty());
+    EXPECT_EQ(table.Size(), 0);
+    EXPECT_EQ(table.Capacity(), 0);
+    EXPECT_EQ(table.MemoryBytes(), 0);
+    EXPECT_EQ(table.Find(1), nullptr);
+}
+
+TEST(SwissTableTest, InsertOrAssign)
+{
+    SwissTable<std::string, int> table;
+    EXPECT_EQ(table.InsertOrAssign("a", 1), 1);
+    table.InsertOrAssign("b", 2);
+    EXPECT_EQ(table.InsertOrAssign("a", 3), 3);
+
+    EXPECT_EQ(table.Size(), 2);
+    ASSERT_NE(table.Find("a"), nullptr);
+    EXPECT_EQ(*table.Find("a"), 3);
+    EXPECT_EQ(*table.Find("b"), 2);
+    EXPECT_EQ(table.Find("c"), nullptr);
+
+    *table.Find("b") = 4;
+    EXPECT_EQ(*std::as_const(table).Find("b"), 4);
+}
+
+TEST(SwissTableTest, GrowsKeepingEntries)
+{
+    SwissTable<std::int64_t, std::int64_t> table;
+    std::unordered_map<std::int64_t, std::int64_t> expected;
+    std::mt19937_64 random(42);
+    for (int index = 0; index < 10000; ++index)
+    {
+        const auto key = static_cast<std::int64_t>(random() % 5000);
+        table.InsertOrAssign(key, index);
+        expected[key] = index;
+        // The table never fills more than 7/8 of its slots.
+        EXPECT_LE(table.Size() * 8, table.Capacity() * 7);
+    }
+
+    EXPECT_EQ(table.Size(), expected.size());
+    for (const auto& [key, value] : expected)
+    {
+        ASSERT_NE(table.Find(key), nullptr) << key;
+        EXPECT_EQ(*table.Find(key), value);
+    }
+    for (std::int64_t key = 5000; key < 6000; ++key) { EXPECT_EQ(table.Find(key), nullptr); }
+}
+
+TEST(SwissTableTest, CollidingKeys)
+{
+    SwissTable<std::int64_t, std::int64_t, CollidingHash> table;
+    for (std::int64_t key = 0; key < 100; ++key) { table.InsertOrAssign(key, -key); }
+
+    EXPECT_EQ(table.Size(), 100);
+    for (std::int64_t key = 0; key < 100; ++key)
+    {
+        ASSERT_NE(table.Find(key), nullptr);
+        EXPECT_EQ(*table.Find(key), -key);
+    }
+    EXPECT_EQ(table.Find(100), nullptr);
+}
+
+TEST(SwissTableTest, ClearReleasesEntries)
+{
+    auto owned = std::make_shared<int>(0);
+    SwissTable<int, std::shared_ptr<int>> table;
+    for (int key = 0; key < 100; ++key) { table.InsertOrAssign(key, owned); }
+    EXPECT_EQ(owned.use_count(), 101);
+    EXPECT_GT(table.MemoryBytes(), 0);
+
+    table.Clear();
+    EXPECT_EQ(owned.use_count(), 1);
+    EXPECT_TRUE(table.Empty());
+    EXPECT_EQ(table.MemoryBytes(), 0);
+    EXPECT_EQ(table.Find(1), nullptr);
+
+    table.InsertOrAssign(1, owned);
+    EXPECT_EQ(*table.Find(1), owned);
+}
+
+TEST(SwissTableTest, MoveTransfersEntries)
+{
+    SwissTable<std::string, std::string> table;
+    table.InsertOrAssign("key", std::string(100, 'v'));
+
+    auto moved = std::move(table);
+    ASSERT_NE(moved.Find("key"), nullptr);
+    EXPECT_EQ(*moved.Find("key"), std::string(100, 'v'));
+
+    table = std::move(moved);
+    EXPECT_EQ(table.Size(), 1);
+    EXPECT_EQ(*table.Find("key"), std::string(100, 'v'));
+}
@@ -0,0 +1,91 @@
+#ifndef DATA_STRUCTURES_MEMORY_USAGE_HPP
+#define DATA_STRUCTURES_MEMORY_USAGE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/**
+ * Memory a value of type T owns on the heap, on top of sizeof(T). Types that own no heap memory,
+ * such as arithmetic types, need no specialization. Specialize it for other types that own heap
+ * memory to have it counted.
+ */
+template <typename T>
+struct MemoryUsage
+{
+    static std::size_t HeapBytes(const T&)
+    {
+        return 0;
+    }
+};
+
+/**
+ * @return Bytes value owns on the heap, see MemoryUsage.
+ */
+template <typename T>
+std::size_t HeapBytes(const T& value)
+{
+    return MemoryUsage<T>::HeapBytes(value);
+}
+
+template <typename TChar, typename TTraits, typename TAllocator>
+struct MemoryUsage<std::basic_string<TChar, TTraits, TAllocator>>
+{
+    static std::size_t HeapBytes(const std::basic_string<TChar, TTraits, TAllocator>& value)
+    {
+        // Short strings are stored inside the string object.
+        const auto data = reinterpret_cast<const std::byte*>(value.data());
+        const auto object = reinterpret_cast<const std::byte*>(std::addressof(value));
+        if (data >= object && data < object + sizeof(value))
+        {
+            return 0;
+        }
+        return (value.capacity() + 1) * sizeof(TChar);
+    }
+};
+
+template <typename T, typename TAllocator>
+struct MemoryUsage<std::vector<T, TAllocator>>
+{
+    static std::size_t HeapBytes(const std::vector<T, TAllocator>& value)
+    {
+        auto bytes = value.capacity() * sizeof(T);
+        for (const auto& element : value) { bytes += ::HeapBytes(element); }
+        return bytes;
+    }
+};
+
+template <typename T>
+struct MemoryUsage<std::optional<T>>
+{
+    static std::size_t HeapBytes(const std::optional<T>& value)
+    {
+        return value ? ::HeapBytes(*value) : 0;
+    }
+};
+
+template <typename T1, typename T2>
+struct MemoryUsage<std::pair<T1, T2>>
+{
+    static std::size_t HeapBytes(const std::pair<T1, T2>& value)
+    {
+        return ::HeapBytes(value.first) + ::HeapBytes(value.second);
+    }
+};
+
+template <typename... Ts>
+struct MemoryUsage<std::tuple<Ts...>>
+{
+    static std::size_t HeapBytes(const std::tuple<Ts...>& value)
+    {
+        return std::apply(
+            [](const auto&... fields) { return (std::size_t{0} + ... + ::HeapBytes(fields)); },
+            value);
+    }
+};
+
+#endif  // DATA_STRUCTURES_MEMORY_USAGE_HPP
@@ -0,0 +1,276 @@
+#ifndef DATA_STRUCTURES_STATS_HPP
+#define DATA_STRUCTURES_STATS_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Whether the data structures collect operation statistics. Defined by the
+ * DATA_STRUCTURES_ENABLE_STATS CMake option; when it is off, the counters are empty types and
+ * recording compiles to nothing.
+ */
+#ifdef DATA_STRUCTURES_ENABLE_STATS
+inline constexpr bool kStatsEnabled = true;
+#else
+inline constexpr bool kStatsEnabled = false;
+#endif
+
+/**
+ * Statistics of one kind of operation, such as Find: the number of calls, the comparisons they
+ * made, and the distribution of their latencies.
+ */
+struct OperationStats
+{
+    /// Bucket 0 counts latencies under 1 ns, bucket b latencies in [2^(b-1), 2^b) ns, and the last
+    /// bucket everything longer.
+    static constexpr std::size_t kLatencyBuckets = 40;
+
+    std::uint64_t calls = 0;
+    std::uint64_t comparisons = 0;
+    std::array<std::uint64_t, kLatencyBuckets> latency_buckets{};
+
+    static std::size_t LatencyBucket(std::chrono::nanoseconds latency)
+    {
+        const auto nanoseconds =
+            latency.count() > 0 ? static_cast<std::uint64_t>(latency.count()) : std::uint64_t{0};
+        return std::min<std::size_t>(std::bit_width(nanoseconds), kLatencyBuckets - 1);
+    }
+
+    /**
+     * @return Upper bound of the latency bucket that contains the given percentile, in [0, 100],
+     * of the calls, or zero if there were no calls.
+     */
+    std::chrono::nanoseconds LatencyPercentile(double percentile) const;
+
+    double MeanComparisons() const
+    {
+        return calls ? static_cast<double>(comparisons) / static_cast<double>(calls) : 0.0;
+    }
+};
+
+/**
+ * Counters behind OperationStats, which can be updated concurrently. Empty when kEnabled is false.
+ *
+ * Copying and moving copy the current counts, so that the structures that own counters stay
+ * movable. The source must not be updated meanwhile.
+ */
+template <bool kEnabled = kStatsEnabled>
+class OperationCounter
+{
+public:
+    OperationCounter() = default;
+
+    OperationCounter(const OperationCounter& other)
+    {
+        CopyFrom(other);
+    }
+
+    OperationCounter& operator=(const OperationCounter& other)
+    {
+        CopyFrom(other);
+        return *this;
+    }
+
+    void Record(std::uint64_t comparisons, std::chrono::nanoseconds latency)
+    {
+        calls_.fetch_add(1, std::memory_order_relaxed);
+        comparisons_.fetch_add(comparisons, std::memory_order_relaxed);
+        latency_buckets_[OperationStats::LatencyBucket(latency)].fetch_add(
+            1, std::memory_order_relaxed);
+    }
+
+    OperationStats Stats() const
+    {
+        OperationStats stats;
+        stats.calls = calls_.load(std::memory_order_relaxed);
+        stats.comparisons = comparisons_.load(std::memory_order_relaxed);
+        for (std::size_t bucket = 0; bucket < OperationStats::kLatencyBuckets; ++bucket)
+        {
+            stats.latency_buckets[bucket] =
+                latency_buckets_[bucket].load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+    void Reset()
+    {
+        calls_.store(0, std::memory_order_relaxed);
+        comparisons_.store(0, std::memory_order_relaxed);
+        for (auto& bucket : latency_buckets_) { bucket.store(0, std::memory_order_relaxed); }
+    }
+
+private:
+    void CopyFrom(const OperationCounter& other)
+    {
+        calls_.store(other.calls_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        comparisons_.store(other.comparisons_.load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+        for (std::size_t bucket = 0; bucket < OperationStats::kLatencyBuckets; ++bucket)
+        {
+            latency_buckets_[bucket].store(
+                other.latency_buckets_[bucket].load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<std::uint64_t> calls_ = 0;
+    std::atomic<std::uint64_t> comparisons_ = 0;
+    std::array<std::atomic<std::uint64_t>, OperationStats::kLatencyBuckets> latency_buckets_{};
+};
+
+template <>
+class OperationCounter<false>
+{
+public:
+    void Record(std::uint64_t, std::chrono::nanoseconds) {}
+
+    OperationStats Stats() const
+    {
+        return {};
+    }
+
+    void Reset() {}
+};
+
+/**
+ * Times an operation from construction to destruction and records it, with the comparisons
+ * counted meanwhile, into an OperationCounter. Does nothing when kEnabled is false.
+ */
+template <bool kEnabled = kStatsEnabled>
+class ScopedOperation
+{
+public:
+    explicit ScopedOperation(OperationCounter<kEnabled>& counter)
+        : counter_(counter), start_(std::chrono::steady_clock::now())
+    {
+    }
+
+    ScopedOperation(const ScopedOperation&) = delete;
+    ScopedOperation& operator=(const ScopedOperation&) = delete;
+
+    ~ScopedOperation()
+    {
+        counter_.Record(comparisons_, std::chrono::steady_clock::now() - start_);
+    }
+
+    void Compare(std::uint64_t comparisons = 1)
+    {
+        comparisons_ += comparisons;
+    }
+
+private:
+    OperationCounter<kEnabled>& counter_;
+    std::chrono::steady_clock::time_point start_;
+    std::uint64_t comparisons_ = 0;
+};
+
+template <>
+class ScopedOperation<false>
+{
+public:
+    explicit ScopedOperation(OperationCounter<false>&) {}
+
+    void Compare(std::uint64_t = 1) {}
+};
+
+/**
+ * Builds a flat JSON object field by field.
+ */
+class JsonObject
+{
+public:
+    JsonObject& Add(std::string_view name, std::uint64_t value)
+    {
+        return AddRaw(name, std::to_string(value));
+    }
+
+    JsonObject& Add(std::string_view name, std::int64_t value)
+    {
+        return AddRaw(name, std::to_string(value));
+    }
+
+    JsonObject& Add(std::string_view name, double value)
+    {
+        return AddRaw(name, std::to_string(value));
+    }
+
+    JsonObject& Add(std::string_view name, const std::vector<std::uint64_t>& values)
+    {
+        std::string array = "[";
+        for (std::size_t index = 0; index < values.size(); ++index)
+        {
+            array += index ? "," : "";
+            array += std::to_string(values[index]);
+        }
+        return AddRaw(name, array + "]");
+    }
+
+    /**
+     * Adds a field whose value is already JSON, such as a nested object.
+     */
+    JsonObject& AddRaw(std::string_view name, std::string_view json)
+    {
+        fields_ += fields_.empty() ? "\"" : ",\"";
+        fields_ += name;
+        fields_ += "\":";
+        fields_ += json;
+        return *this;
+    }
+
+    std::string Str() const
+    {
+        return "{" + fields_ + "}";
+    }
+
+private:
+    std::string fields_;
+};
+
+inline std::chrono::nanoseconds OperationStats::LatencyPercentile(double percentile) const
+{
+    if (!calls)
+    {
+        return std::chrono::nanoseconds(0);
+    }
+
+    // Nearest rank: the smallest latency not exceeded by the given share of the calls.
+    const auto rank = std::max<std::uint64_t>(
+        static_cast<std::uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(calls))), 1);
+    std::uint64_t seen = 0;
+    std::size_t bucket = 0;
+    for (; bucket + 1 < kLatencyBuckets; ++bucket)
+    {
+        seen += latency_buckets[bucket];
+        if (seen >= rank)
+        {
+            break;
+        }
+    }
+    return std::chrono::nanoseconds(std::int64_t{1} << bucket);
+}
+
+/**
+ * @return JSON object with the calls, comparisons and latency percentiles of the operation.
+ */
+inline std::string ToJson(const OperationStats& stats)
+{
+    return JsonObject()
+        .Add("calls", stats.calls)
+        .Add("comparisons", stats.comparisons)
+        .Add("mean_comparisons", stats.MeanComparisons())
+        .Add("p50_ns", static_cast<std::int64_t>(stats.LatencyPercentile(50).count()))
+        .Add("p99_ns", static_cast<std::int64_t>(stats.LatencyPercentile(99).count()))
+        .Add("max_ns", static_cast<std::int64_t>(stats.LatencyPercentile(100).count()))
+        .Str();
+}
+
+#endif  // DATA_STRUCTURES_STATS_HPP
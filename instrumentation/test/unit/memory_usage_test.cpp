@@ -0,0 +1,40 @@
+#include <data-structures/instrumentation/memory_usage.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+TEST(MemoryUsageTest, ValuesWithoutHeapMemory)
+{
+    EXPECT_EQ(HeapBytes(42), 0u);
+    EXPECT_EQ(HeapBytes(std::make_pair(1.0, 'x')), 0u);
+    EXPECT_EQ(HeapBytes(std::string("short")), 0u);
+    EXPECT_EQ(HeapBytes(std::optional<std::string>()), 0u);
+}
+
+TEST(MemoryUsageTest, StringsAndVectors)
+{
+    const std::string long_string(100, 'x');
+    EXPECT_EQ(HeapBytes(long_string), long_string.capacity() + 1);
+
+    std::vector<std::int64_t> numbers;
+    numbers.reserve(10);
+    EXPECT_EQ(HeapBytes(numbers), 10 * sizeof(std::int64_t));
+
+    std::vector<std::string> strings{long_string, "short"};
+    EXPECT_EQ(HeapBytes(strings),
+              strings.capacity() * sizeof(std::string) + HeapBytes(long_string));
+}
+
+TEST(MemoryUsageTest, NestedTypesAddUp)
+{
+    const std::string long_string(100, 'x');
+    const auto entry = std::make_tuple(1, long_string, std::vector<std::string>{long_string});
+    const std::optional<decltype(entry)> logged(entry);
+    EXPECT_EQ(HeapBytes(logged), HeapBytes(long_string) + HeapBytes(std::get<2>(entry)));
+}
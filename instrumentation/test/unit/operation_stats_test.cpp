@@ -0,0 +1,99 @@
+#include <data-structures/instrumentation/stats.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <type_traits>
+#include <utility>
+
+using namespace std::chrono_literals;
+
+static_assert(kStatsEnabled);
+static_assert(std::is_empty_v<OperationCounter<false>>);
+static_assert(std::is_empty_v<ScopedOperation<false>>);
+
+TEST(OperationStatsTest, LatencyBuckets)
+{
+    EXPECT_EQ(OperationStats::LatencyBucket(0ns), 0u);
+    EXPECT_EQ(OperationStats::LatencyBucket(-5ns), 0u);
+    EXPECT_EQ(OperationStats::LatencyBucket(1ns), 1u);
+    EXPECT_EQ(OperationStats::LatencyBucket(2ns), 2u);
+    EXPECT_EQ(OperationStats::LatencyBucket(3ns), 2u);
+    EXPECT_EQ(OperationStats::LatencyBucket(1024ns), 11u);
+    EXPECT_EQ(OperationStats::LatencyBucket(std::chrono::hours(1000)),
+              OperationStats::kLatencyBuckets - 1);
+}
+
+TEST(OperationStatsTest, CounterRecordsCallsComparisonsAndPercentiles)
+{
+    OperationCounter<> counter;
+    for (int call = 0; call < 98; ++call) { counter.Record(2, 100ns); }
+    counter.Record(10, 5000ns);
+    counter.Record(10, 70000ns);
+
+    const auto stats = counter.Stats();
+    EXPECT_EQ(stats.calls, 100u);
+    EXPECT_EQ(stats.comparisons, 216u);
+    EXPECT_DOUBLE_EQ(stats.MeanComparisons(), 2.16);
+    EXPECT_EQ(stats.LatencyPercentile(50), 128ns);
+    EXPECT_EQ(stats.LatencyPercentile(99), 8192ns);
+    EXPECT_EQ(stats.LatencyPercentile(100), 131072ns);
+
+    counter.Reset();
+    EXPECT_EQ(counter.Stats().calls, 0u);
+    EXPECT_EQ(counter.Stats().LatencyPercentile(50), 0ns);
+}
+
+TEST(OperationStatsTest, ScopedOperationRecordsOnDestruction)
+{
+    OperationCounter<> counter;
+    {
+        ScopedOperation<> operation(counter);
+        operation.Compare();
+        operation.Compare(2);
+        EXPECT_EQ(counter.Stats().calls, 0u);
+    }
+    EXPECT_EQ(counter.Stats().calls, 1u);
+    EXPECT_EQ(counter.Stats().comparisons, 3u);
+}
+
+TEST(OperationStatsTest, CopiesAndMovesKeepCounts)
+{
+    OperationCounter<> counter;
+    counter.Record(3, 100ns);
+
+    auto copy = counter;
+    counter.Record(1, 100ns);
+    EXPECT_EQ(copy.Stats().calls, 1u);
+    EXPECT_EQ(copy.Stats().comparisons, 3u);
+    EXPECT_EQ(copy.Stats().LatencyPercentile(100), 128ns);
+
+    copy = std::move(counter);
+    EXPECT_EQ(copy.Stats().calls, 2u);
+    EXPECT_EQ(copy.Stats().comparisons, 4u);
+}
+
+TEST(OperationStatsTest, DisabledCounterStaysZero)
+{
+    OperationCounter<false> counter;
+    {
+        ScopedOperation<false> operation(counter);
+        operation.Compare(5);
+    }
+    EXPECT_EQ(counter.Stats().calls, 0u);
+}
+
+TEST(OperationStatsTest, Json)
+{
+    OperationCounter<> counter;
+    counter.Record(3, 100ns);
+    EXPECT_EQ(ToJson(counter.Stats()),
+              "{\"calls\":1,\"comparisons\":3,\"mean_comparisons\":3.000000,\"p50_ns\":128,"
+              "\"p99_ns\":128,\"max_ns\":128}");
+
+    EXPECT_EQ(JsonObject()
+                  .Add("list", std::vector<std::uint64_t>{1, 2})
+                  .AddRaw("nested", JsonObject().Add("x", std::int64_t{-1}).Str())
+                  .Str(),
+              "{\"list\":[1,2],\"nested\":{\"x\":-1}}");
+}
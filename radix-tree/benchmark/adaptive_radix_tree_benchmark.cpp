@@ -0,0 +1,135 @@
+#include <data-structures/binary-search-tree/bst_node.hpp>
+#include <data-structures/binary-search-tree/bt_update_strategies.hpp>
+#include <data-structures/radix-tree/adaptive_radix_tree.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t kLookups = 1 << 16;
+
+std::vector<std::int64_t> RandomIntegers(std::int64_t size)
+{
+    std::mt19937_64 random(42);
+    std::vector<std::int64_t> keys(size);
+    for (auto& key : keys) { key = static_cast<std::int64_t>(random()); }
+    return keys;
+}
+
+/**
+ * Keys shaped like log identifiers: a shared prefix, a few hosts and a counter.
+ */
+std::vector<std::string> RandomStrings(std::int64_t size)
+{
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> host(0, 15);
+    std::vector<std::string> keys;
+    keys.reserve(size);
+    for (std::int64_t index = 0; index < size; ++index)
+    {
+        keys.push_back("service/host-" + std::to_string(host(random)) + "/" +
+                       std::to_string(index));
+    }
+    std::shuffle(keys.begin(), keys.end(), random);
+    return keys;
+}
+
+template <typename TKey>
+std::vector<TKey> MakeKeys(std::int64_t size)
+{
+    if constexpr (std::is_same_v<TKey, std::string>)
+    {
+        return RandomStrings(size);
+    }
+    else
+    {
+        return RandomIntegers(size);
+    }
+}
+
+template <typename TKey>
+auto MakeBST(const std::vector<TKey>& keys)
+{
+    auto root = MakeBSTNode<RejectUpdates<TKey, int>>(keys.front(), 0);
+    for (const auto& key : keys) { root->Insert(key, 0); }
+    return root;
+}
+
+template <typename TKey>
+auto MakeART(const std::vector<TKey>& keys)
+{
+    AdaptiveRadixTree<TKey, int> tree;
+    for (const auto& key : keys) { tree.Insert(key, 0); }
+    return tree;
+}
+
+template <typename TKey>
+std::vector<TKey> SampleLookups(const std::vector<TKey>& keys)
+{
+    std::mt19937 random(7);
+    std::uniform_int_distribution<std::size_t> index(0, keys.size() - 1);
+    std::vector<TKey> lookups;
+    lookups.reserve(kLookups);
+    for (std::size_t lookup = 0; lookup < kLookups; ++lookup)
+    { lookups.push_back(keys[index(random)]); }
+    return lookups;
+}
+}  // namespace
+
+template <typename TKey>
+static void BM_BSTInsert(benchmark::State& state)
+{
+    const auto keys = MakeKeys<TKey>(state.range(0));
+    for (auto _ : state) { benchmark::DoNotOptimize(MakeBST(keys)); }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_BSTInsert, std::int64_t)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_BSTInsert, std::string)->Arg(1 << 12)->Arg(1 << 16);
+
+template <typename TKey>
+static void BM_ARTInsert(benchmark::State& state)
+{
+    const auto keys = MakeKeys<TKey>(state.range(0));
+    for (auto _ : state) { benchmark::DoNotOptimize(MakeART(keys)); }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_ARTInsert, std::int64_t)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_ARTInsert, std::string)->Arg(1 << 12)->Arg(1 << 16);
+
+template <typename TKey>
+static void BM_BSTFind(benchmark::State& state)
+{
+    const auto keys = MakeKeys<TKey>(state.range(0));
+    const auto root = MakeBST(keys);
+    const auto lookups = SampleLookups(keys);
+    for (auto _ : state)
+    {
+        for (const auto& key : lookups) { benchmark::DoNotOptimize(root->Find(key)); }
+    }
+    state.SetItemsProcessed(state.iterations() * kLookups);
+}
+BENCHMARK_TEMPLATE(BM_BSTFind, std::int64_t)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_BSTFind, std::string)->Arg(1 << 12)->Arg(1 << 16);
+
+template <typename TKey>
+static void BM_ARTFind(benchmark::State& state)
+{
+    const auto keys = MakeKeys<TKey>(state.range(0));
+    const auto tree = MakeART(keys);
+    const auto lookups = SampleLookups(keys);
+    for (auto _ : state)
+    {
+        for (const auto& key : lookups) { benchmark::DoNotOptimize(tree.Find(key)); }
+    }
+    state.SetItemsProcessed(state.iterations() * kLookups);
+}
+BENCHMARK_TEMPLATE(BM_ARTFind, std::int64_t)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_ARTFind, std::string)->Arg(1 << 12)->Arg(1 << 16);
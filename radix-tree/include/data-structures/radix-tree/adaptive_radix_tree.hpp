@@ -0,0 +1,676 @@
+#ifndef DATA_STRUCTURES_ADAPTIVE_RADIX_TREE_HPP
+#define DATA_STRUCTURES_ADAPTIVE_RADIX_TREE_HPP
+
+#include "radix_key.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/**
+ * Adaptive radix tree (ART) that maps keys to values, ordered by the binary-comparable encoding of
+ * the keys given by RadixKey.
+ *
+ * Inner nodes branch on one byte of the encoded key and come in four sizes, holding up to 4, 16, 48
+ * and 256 children, and grow from one size to the next as children are added. Paths of inner nodes
+ * with a single child are collapsed into the prefix of the next inner node (path compression), and
+ * a leaf is stored as soon as its key is the only one below a node (lazy expansion). The height of
+ * the tree is thus bounded by the length of the encoded keys rather than by the number of keys, and
+ * lookups take no key comparisons apart from the final one at the leaf.
+ *
+ * The keys of the 16-children nodes are searched with SSE2 instructions where available.
+ *
+ * @tparam TKey key type, for which RadixKey<TKey> must be defined.
+ * @tparam TValue value type
+ */
+template <typename TKey, typename TValue>
+class AdaptiveRadixTree
+{
+public:
+    AdaptiveRadixTree() = default;
+
+    /**
+     * Inserts the value under key, if the tree does not already contain the key.
+     *
+     * @param key Key of the new entry.
+     * @param value Value of the new entry.
+     * @return a pair consisting of a pointer to the value under key and a boolean that is true if
+     * the insertion took place.
+     */
+    std::pair<TValue*, bool> Insert(TKey key, TValue value);
+
+    /**
+     * @return Pointer to the value under key, or nullptr if the tree does not contain key.
+     */
+    TValue* Find(const TKey& key);
+
+    const TValue* Find(const TKey& key) const;
+
+    /**
+     * Calls visit(key, value) for every entry in key order, until visit returns false.
+     * @return false if visit stopped the traversal, true otherwise.
+     */
+    template <typename TVisitor>
+    bool ForEach(TVisitor&& visit) const;
+
+    /**
+     * Calls visit(key, value) for every entry with a key not less than the given one, in key order,
+     * until visit returns false.
+     * @return false if visit stopped the traversal, true otherwise.
+     */
+    template <typename TVisitor>
+    bool ForEachFrom(const TKey& key, TVisitor&& visit) const;
+
+    std::size_t Size() const
+    {
+        return size_;
+    }
+
+    bool Empty() const
+    {
+        return size_ == 0;
+    }
+
+    /**
+     * @return Bytes of the nodes of the tree, including the keys and values stored in the leaves
+     * and the encoded keys, but not the memory keys and values own on the heap, compressed paths
+     * longer than fit in a string object, or allocator overhead.
+     */
+    std::size_t MemoryBytes() const
+    {
+        return node_bytes_;
+    }
+
+    void Clear()
+    {
+        root_.reset();
+        size_ = 0;
+        node_bytes_ = 0;
+    }
+
+private:
+    enum class NodeKind : std::uint8_t
+    {
+        kLeaf,
+        kNode4,
+        kNode16,
+        kNode48,
+        kNode256
+    };
+
+    struct Node
+    {
+        explicit Node(NodeKind kind) : kind(kind) {}
+
+        virtual ~Node() = default;
+
+        NodeKind kind;
+    };
+
+    using NodePtr = std::unique_ptr<Node>;
+
+    struct Leaf : Node
+    {
+        Leaf(std::string encoded, TKey key, TValue value)
+            : Node(NodeKind::kLeaf),
+              encoded(std::move(encoded)),
+              key(std::move(key)),
+              value(std::move(value))
+        {
+        }
+
+        std::string encoded;
+        TKey key;
+        TValue value;
+    };
+
+    struct Inner : Node
+    {
+        using Node::Node;
+
+        /// Compressed path: bytes shared by all the keys below, following the byte that led here.
+        std::string prefix;
+        std::uint16_t child_count = 0;
+    };
+
+    /// Keys are kept sorted, with children at the same positions.
+    template <std::size_t capacity, NodeKind node_kind>
+    struct SortedNode : Inner
+    {
+        SortedNode() : Inner(node_kind) {}
+
+        alignas(16) std::array<std::uint8_t, capacity> keys{};
+        std::array<NodePtr, capacity> children;
+    };
+
+    using Node4 = SortedNode<4, NodeKind::kNode4>;
+    using Node16 = SortedNode<16, NodeKind::kNode16>;
+
+    struct Node48 : Inner
+    {
+        static constexpr std::uint8_t kEmpty = 0xFF;
+
+        Node48() : Inner(NodeKind::kNode48)
+        {
+            child_index.fill(kEmpty);
+        }
+
+        /// Position of the child for each key byte in children, or kEmpty.
+        std::array<std::uint8_t, 256> child_index;
+        std::array<NodePtr, 48> children;
+    };
+
+    struct Node256 : Inner
+    {
+        Node256() : Inner(NodeKind::kNode256) {}
+
+        std::array<NodePtr, 256> children;
+    };
+
+    static const NodePtr* FindChild(const Inner& node, std::uint8_t byte);
+
+    static std::size_t NodeBytes(NodeKind kind);
+
+    /**
+     * @return Position of the first key not less than byte among the keys of a sorted node.
+     */
+    template <typename TSortedNode>
+    static std::size_t LowerBound(const TSortedNode& node, std::uint8_t byte);
+
+    /**
+     * Adds child under byte to the inner node at node_ref, replacing the node with a larger one if
+     * it is full.
+     */
+    static void AddChild(NodePtr& node_ref, std::uint8_t byte, NodePtr child);
+
+    template <typename TSortedNode>
+    static void InsertSorted(TSortedNode& node, std::uint8_t byte, NodePtr child);
+
+    /**
+     * Moves the prefix and the children of a full node into a node of the next size.
+     */
+    template <typename TTarget, typename TSource>
+    static std::unique_ptr<TTarget> Grow(TSource& source);
+
+    /**
+     * Calls visit(byte, child) for the children of node under bytes not less than from, in order,
+     * until visit returns false.
+     * @return false if visit stopped the traversal, true otherwise.
+     */
+    template <typename TVisitor>
+    static bool ForEachChild(const Inner& node, std::uint8_t from, TVisitor&& visit);
+
+    template <typename TVisitor>
+    static bool VisitAll(const Node& node, TVisitor& visit);
+
+    template <typename TVisitor>
+    static bool VisitFrom(const Node& node,
+                          std::size_t depth,
+                          std::string_view key,
+                          TVisitor& visit);
+
+    NodePtr root_;
+    std::size_t size_ = 0;
+    std::size_t node_bytes_ = 0;
+};
+
+template <typename TKey, typename TValue>
+std::pair<TValue*, bool> AdaptiveRadixTree<TKey, TValue>::Insert(TKey key, TValue value)
+{
+    auto encoded = EncodeRadixKey(key);
+    auto leaf = std::make_unique<Leaf>(std::move(encoded), std::move(key), std::move(value));
+    const std::string_view new_key = leaf->encoded;
+    const auto inserted_value = &leaf->value;
+    auto new_bytes = NodeBytes(NodeKind::kLeaf);
+    if (leaf->encoded.capacity() > std::string().capacity())
+    {
+        new_bytes += leaf->encoded.capacity() + 1;
+    }
+
+    auto node_ref = &root_;
+    std::size_t depth = 0;
+    while (*node_ref)
+    {
+        auto& node = **node_ref;
+        if (node.kind == NodeKind::kLeaf)
+        {
+            auto& existing = static_cast<Leaf&>(node);
+            if (existing.encoded == new_key)
+            {
+                return {&existing.value, false};
+            }
+
+            // Encoded keys are prefix-free, so the two keys differ before either of them ends.
+            auto mismatch = depth;
+            while (existing.encoded[mismatch] == new_key[mismatch]) { ++mismatch; }
+
+            auto split = std::make_unique<Node4>();
+            split->prefix = new_key.substr(depth, mismatch - depth);
+            const auto existing_byte = static_cast<std::uint8_t>(existing.encoded[mismatch]);
+            InsertSorted(*split, existing_byte, std::move(*node_ref));
+            InsertSorted(*split, static_cast<std::uint8_t>(new_key[mismatch]), std::move(leaf));
+            *node_ref = std::move(split);
+            new_bytes += NodeBytes(NodeKind::kNode4);
+            break;
+        }
+
+        auto& inner = static_cast<Inner&>(node);
+        std::size_t matched = 0;
+        while (matched < inner.prefix.size() && depth + matched < new_key.size()
+               && inner.prefix[matched] == new_key[depth + matched])
+        { ++matched; }
+
+        if (matched < inner.prefix.size())
+        {
+            // The new key leaves the compressed path: split it at the first differing byte.
+            auto split = std::make_unique<Node4>();
+            split->prefix = inner.prefix.substr(0, matched);
+            const auto inner_byte = static_cast<std::uint8_t>(inner.prefix[matched]);
+            inner.prefix.erase(0, matched + 1);
+            InsertSorted(*split, inner_byte, std::move(*node_ref));
+            const auto new_byte = static_cast<std::uint8_t>(new_key[depth + matched]);
+            InsertSorted(*split, new_byte, std::move(leaf));
+            *node_ref = std::move(split);
+            new_bytes += NodeBytes(NodeKind::kNode4);
+            break;
+        }
+
+        depth += matched;
+        assert(depth < new_key.size() && "Encoded keys must be prefix-free");
+        const auto byte = static_cast<std::uint8_t>(new_key[depth]);
+        if (const auto child = FindChild(inner, byte))
+        {
+            node_ref = const_cast<NodePtr*>(child);
+            ++depth;
+            continue;
+        }
+
+        const auto kind = inner.kind;
+        AddChild(*node_ref, byte, std::move(leaf));
+        // The node is replaced by a larger one if it was full.
+        new_bytes += NodeBytes((*node_ref)->kind) - NodeBytes(kind);
+        break;
+    }
+
+    if (leaf)
+    {
+        *node_ref = std::move(leaf);
+    }
+    ++size_;
+    node_bytes_ += new_bytes;
+    return {inserted_value, true};
+}
+
+template <typename TKey, typename TValue>
+TValue* AdaptiveRadixTree<TKey, TValue>::Find(const TKey& key)
+{
+    return const_cast<TValue*>(std::as_const(*this).Find(key));
+}
+
+template <typename TKey, typename TValue>
+const TValue* AdaptiveRadixTree<TKey, TValue>::Find(const TKey& key) const
+{
+    const auto encoded = EncodeRadixKey(key);
+
+    // Compressed paths are skipped without comparing them, since the leaf holds the whole key.
+    auto node = root_.get();
+    std::size_t depth = 0;
+    while (node && node->kind != NodeKind::kLeaf)
+    {
+        const auto& inner = static_cast<const Inner&>(*node);
+        depth += inner.prefix.size();
+        if (depth >= encoded.size())
+        {
+            return nullptr;
+        }
+        const auto child = FindChild(inner, static_cast<std::uint8_t>(encoded[depth]));
+        node = child ? child->get() : nullptr;
+        ++depth;
+    }
+
+    if (!node)
+    {
+        return nullptr;
+    }
+    const auto& leaf = static_cast<const Leaf&>(*node);
+    return leaf.encoded == encoded ? &leaf.value : nullptr;
+}
+
+template <typename TKey, typename TValue>
+template <typename TVisitor>
+bool AdaptiveRadixTree<TKey, TValue>::ForEach(TVisitor&& visit) const
+{
+    return !root_ || VisitAll(*root_, visit);
+}
+
+template <typename TKey, typename TValue>
+template <typename TVisitor>
+bool AdaptiveRadixTree<TKey, TValue>::ForEachFrom(const TKey& key, TVisitor&& visit) const
+{
+    return !root_ || VisitFrom(*root_, 0, EncodeRadixKey(key), visit);
+}
+
+template <typename TKey, typename TValue>
+const typename AdaptiveRadixTree<TKey, TValue>::NodePtr* AdaptiveRadixTree<TKey, TValue>::FindChild(
+    const Inner& node, std::uint8_t byte)
+{
+    switch (node.kind)
+    {
+        case NodeKind::kNode4:
+        {
+            const auto& node4 = static_cast<const Node4&>(node);
+            for (std::size_t index = 0; index < node4.child_count; ++index)
+            {
+                if (node4.keys[index] == byte)
+                {
+                    return &node4.children[index];
+                }
+            }
+            return nullptr;
+        }
+        case NodeKind::kNode16:
+        {
+            const auto& node16 = static_cast<const Node16&>(node);
+#ifdef __SSE2__
+            const auto keys = _mm_load_si128(reinterpret_cast<const __m128i*>(node16.keys.data()));
+            const auto matches = _mm_cmpeq_epi8(keys, _mm_set1_epi8(static_cast<char>(byte)));
+            const auto mask = static_cast<unsigned>(_mm_movemask_epi8(matches))
+                              & ((1u << node16.child_count) - 1);
+            return mask ? &node16.children[std::countr_zero(mask)] : nullptr;
+#else
+            const auto index = LowerBound(node16, byte);
+            return index < node16.child_count && node16.keys[index] == byte
+                       ? &node16.children[index]
+                       : nullptr;
+#endif
+        }
+        case NodeKind::kNode48:
+        {
+            const auto& node48 = static_cast<const Node48&>(node);
+            const auto index = node48.child_index[byte];
+            return index == Node48::kEmpty ? nullptr : &node48.children[index];
+        }
+        case NodeKind::kNode256:
+        {
+            const auto& child = static_cast<const Node256&>(node).children[byte];
+            return child ? &child : nullptr;
+        }
+        case NodeKind::kLeaf:
+            break;
+    }
+    return nullptr;
+}
+
+template <typename TKey, typename TValue>
+template <typename TSortedNode>
+std::size_t AdaptiveRadixTree<TKey, TValue>::LowerBound(const TSortedNode& node, std::uint8_t byte)
+{
+#ifdef __SSE2__
+    if constexpr (std::is_same_v<TSortedNode, Node16>)
+    {
+        // SSE2 only compares signed bytes, so both sides are shifted into the signed range.
+        const auto bias = _mm_set1_epi8(static_cast<char>(0x80));
+        const auto keys = _mm_load_si128(reinterpret_cast<const __m128i*>(node.keys.data()));
+        const auto bound = _mm_xor_si128(_mm_set1_epi8(static_cast<char>(byte)), bias);
+        const auto less = _mm_cmplt_epi8(_mm_xor_si128(keys, bias), bound);
+        const auto mask =
+            static_cast<unsigned>(_mm_movemask_epi8(less)) & ((1u << node.child_count) - 1);
+        return static_cast<std::size_t>(std::popcount(mask));
+    }
+#endif
+    return static_cast<std::size_t>(
+        std::lower_bound(node.keys.begin(), node.keys.begin() + node.child_count, byte)
+        - node.keys.begin());
+}
+
+template <typename TKey, typename TValue>
+std::size_t AdaptiveRadixTree<TKey, TValue>::NodeBytes(NodeKind kind)
+{
+    switch (kind)
+    {
+        case NodeKind::kLeaf:
+            return sizeof(Leaf);
+        case NodeKind::kNode4:
+            return sizeof(Node4);
+        case NodeKind::kNode16:
+            return sizeof(Node16);
+        case NodeKind::kNode48:
+            return sizeof(Node48);
+        case NodeKind::kNode256:
+            return sizeof(Node256);
+    }
+    return 0;
+}
+
+template <typename TKey, typename TValue>
+void AdaptiveRadixTree<TKey, TValue>::AddChild(NodePtr& node_ref, std::uint8_t byte, NodePtr child)
+{
+    switch (node_ref->kind)
+    {
+        case NodeKind::kNode4:
+        {
+            auto& node4 = static_cast<Node4&>(*node_ref);
+            if (node4.child_count < node4.keys.size())
+            {
+                InsertSorted(node4, byte, std::move(child));
+                return;
+            }
+            auto node16 = Grow<Node16>(node4);
+            InsertSorted(*node16, byte, std::move(child));
+            node_ref = std::move(node16);
+            return;
+        }
+        case NodeKind::kNode16:
+        {
+            auto& node16 = static_cast<Node16&>(*node_ref);
+            if (node16.child_count < node16.keys.size())
+            {
+                InsertSorted(node16, byte, std::move(child));
+                return;
+            }
+            node_ref = Grow<Node48>(node16);
+            break;
+        }
+        case NodeKind::kNode48:
+        {
+            auto& node48 = static_cast<Node48&>(*node_ref);
+            if (node48.child_count == node48.children.size())
+            {
+                node_ref = Grow<Node256>(node48);
+            }
+            break;
+        }
+        case NodeKind::kNode256:
+        case NodeKind::kLeaf:
+            break;
+    }
+
+    auto& inner = static_cast<Inner&>(*node_ref);
+    if (inner.kind == NodeKind::kNode48)
+    {
+        // Without removals, the children occupy the first child_count positions.
+        auto& node48 = static_cast<Node48&>(inner);
+        node48.child_index[byte] = static_cast<std::uint8_t>(node48.child_count);
+        node48.children[node48.child_count] = std::move(child);
+    }
+    else
+    {
+        static_cast<Node256&>(inner).children[byte] = std::move(child);
+    }
+    ++inner.child_count;
+}
+
+template <typename TKey, typename TValue>
+template <typename TSortedNode>
+void AdaptiveRadixTree<TKey, TValue>::InsertSorted(TSortedNode& node,
+                                                   std::uint8_t byte,
+                                                   NodePtr child)
+{
+    const auto index = LowerBound(node, byte);
+    std::move_backward(node.keys.begin() + index,
+                       node.keys.begin() + node.child_count,
+                       node.keys.begin() + node.child_count + 1);
+    std::move_backward(node.children.begin() + index,
+                       node.children.begin() + node.child_count,
+                       node.children.begin() + node.child_count + 1);
+    node.keys[index] = byte;
+    node.children[index] = std::move(child);
+    ++node.child_count;
+}
+
+template <typename TKey, typename TValue>
+template <typename TTarget, typename TSource>
+std::unique_ptr<TTarget> AdaptiveRadixTree<TKey, TValue>::Grow(TSource& source)
+{
+    auto target = std::make_unique<TTarget>();
+    target->prefix = std::move(source.prefix);
+    target->child_count = source.child_count;
+
+    if constexpr (std::is_same_v<TTarget, Node16>)
+    {
+        std::copy_n(source.keys.begin(), source.child_count, target->keys.begin());
+        std::move(source.children.begin(),
+                  source.children.begin() + source.child_count,
+                  target->children.begin());
+    }
+    else if constexpr (std::is_same_v<TTarget, Node48>)
+    {
+        for (std::size_t index = 0; index < source.child_count; ++index)
+        {
+            target->child_index[source.keys[index]] = static_cast<std::uint8_t>(index);
+            target->children[index] = std::move(source.children[index]);
+        }
+    }
+    else
+    {
+        for (std::size_t byte = 0; byte < source.child_index.size(); ++byte)
+        {
+            if (source.child_index[byte] != TSource::kEmpty)
+            {
+                target->children[byte] = std::move(source.children[source.child_index[byte]]);
+            }
+        }
+    }
+    return target;
+}
+
+template <typename TKey, typename TValue>
+template <typename TVisitor>
+bool AdaptiveRadixTree<TKey, TValue>::ForEachChild(const Inner& node,
+                                                   std::uint8_t from,
+                                                   TVisitor&& visit)
+{
+    const auto for_each_sorted = [&](const auto& sorted) {
+        for (auto index = LowerBound(sorted, from); index < sorted.child_count; ++index)
+        {
+            if (!visit(sorted.keys[index], *sorted.children[index]))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    switch (node.kind)
+    {
+        case NodeKind::kNode4:
+            return for_each_sorted(static_cast<const Node4&>(node));
+        case NodeKind::kNode16:
+            return for_each_sorted(static_cast<const Node16&>(node));
+        case NodeKind::kNode48:
+        {
+            const auto& node48 = static_cast<const Node48&>(node);
+            for (std::size_t byte = from; byte < node48.child_index.size(); ++byte)
+            {
+                const auto index = node48.child_index[byte];
+                if (index != Node48::kEmpty
+                    && !visit(static_cast<std::uint8_t>(byte), *node48.children[index]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case NodeKind::kNode256:
+        {
+            const auto& node256 = static_cast<const Node256&>(node);
+            for (std::size_t byte = from; byte < node256.children.size(); ++byte)
+            {
+                if (node256.children[byte]
+                    && !visit(static_cast<std::uint8_t>(byte), *node256.children[byte]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case NodeKind::kLeaf:
+            break;
+    }
+    return true;
+}
+
+template <typename TKey, typename TValue>
+template <typename TVisitor>
+bool AdaptiveRadixTree<TKey, TValue>::VisitAll(const Node& node, TVisitor& visit)
+{
+    if (node.kind == NodeKind::kLeaf)
+    {
+        const auto& leaf = static_cast<const Leaf&>(node);
+        return visit(leaf.key, leaf.value);
+    }
+    const auto visit_child = [&visit](std::uint8_t, const Node& child) {
+        return VisitAll(child, visit);
+    };
+    return ForEachChild(static_cast<const Inner&>(node), 0, visit_child);
+}
+
+template <typename TKey, typename TValue>
+template <typename TVisitor>
+bool AdaptiveRadixTree<TKey, TValue>::VisitFrom(const Node& node,
+                                                std::size_t depth,
+                                                std::string_view key,
+                                                TVisitor& visit)
+{
+    if (node.kind == NodeKind::kLeaf)
+    {
+        const auto& leaf = static_cast<const Leaf&>(node);
+        return std::string_view(leaf.encoded) < key || visit(leaf.key, leaf.value);
+    }
+
+    // Every key below the node starts with the key bytes up to depth, followed by the prefix.
+    const auto& inner = static_cast<const Inner&>(node);
+    const auto rest = key.substr(depth);
+    const auto compared = std::min(inner.prefix.size(), rest.size());
+    if (const auto order = std::string_view(inner.prefix).substr(0, compared).compare(
+            rest.substr(0, compared));
+        order != 0)
+    {
+        return order < 0 || VisitAll(node, visit);
+    }
+    if (rest.size() <= inner.prefix.size())
+    {
+        return VisitAll(node, visit);
+    }
+
+    depth += inner.prefix.size();
+    const auto byte = static_cast<std::uint8_t>(key[depth]);
+    return ForEachChild(inner, byte, [&](std::uint8_t child_byte, const Node& child) {
+        return child_byte == byte ? VisitFrom(child, depth + 1, key, visit)
+                                  : VisitAll(child, visit);
+    });
+}
+
+#endif  // DATA_STRUCTURES_ADAPTIVE_RADIX_TREE_HPP
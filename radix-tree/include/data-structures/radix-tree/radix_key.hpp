@@ -0,0 +1,91 @@
+#ifndef DATA_STRUCTURES_RADIX_KEY_HPP
+#define DATA_STRUCTURES_RADIX_KEY_HPP
+
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * Binary-comparable encoding of keys: encoded keys compare lexicographically, byte by byte, in the
+ * same order as the keys themselves, and no encoded key is a proper prefix of another one.
+ *
+ * Specializations provide static void Append(std::string& out, const TKey& key), which appends the
+ * encoding of key to out. Types can also opt in with a member AppendRadixKey(std::string&).
+ */
+template <typename TKey>
+struct RadixKey;
+
+/**
+ * Integers are encoded big-endian, with the sign bit of signed integers flipped so that negative
+ * numbers precede positive ones.
+ */
+template <std::integral TKey>
+struct RadixKey<TKey>
+{
+    static void Append(std::string& out, TKey key)
+    {
+        using Unsigned = std::make_unsigned_t<TKey>;
+        auto bits = static_cast<Unsigned>(key);
+        if constexpr (std::is_signed_v<TKey>)
+        {
+            bits ^= Unsigned{1} << (sizeof(TKey) * CHAR_BIT - 1);
+        }
+        for (auto byte = sizeof(TKey); byte > 0; --byte)
+        { out.push_back(static_cast<char>((bits >> ((byte - 1) * CHAR_BIT)) & 0xFF)); }
+    }
+};
+
+/**
+ * Strings are terminated by the pair 0x00 0x00, and their zero bytes are escaped as 0x00 0x01, so
+ * that a string sorts before its extensions.
+ */
+template <>
+struct RadixKey<std::string_view>
+{
+    static void Append(std::string& out, std::string_view key)
+    {
+        for (const auto byte : key)
+        {
+            out.push_back(byte);
+            if (byte == '\0')
+            {
+                out.push_back('\1');
+            }
+        }
+        out.append(2, '\0');
+    }
+};
+
+template <>
+struct RadixKey<std::string> : RadixKey<std::string_view>
+{
+};
+
+template <typename TKey>
+requires requires(const TKey& key, std::string& out)
+{
+    key.AppendRadixKey(out);
+}
+struct RadixKey<TKey>
+{
+    static void Append(std::string& out, const TKey& key)
+    {
+        key.AppendRadixKey(out);
+    }
+};
+
+/**
+ * @return The binary-comparable encoding of key.
+ */
+template <typename TKey>
+std::string EncodeRadixKey(const TKey& key)
+{
+    std::string encoded;
+    RadixKey<TKey>::Append(encoded, key);
+    return encoded;
+}
+
+#endif  // DATA_STRUCTURES_RADIX_KEY_HPP
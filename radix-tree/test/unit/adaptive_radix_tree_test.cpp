@@ -0,0 +1,199 @@
+#include <data-structures/radix-tree/adaptive_radix_tree.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+template <typename TKey, typename TValue>
+std::vector<std::pair<TKey, TValue>> Entries(const AdaptiveRadixTree<TKey, TValue>& tree)
+{
+    std::vector<std::pair<TKey, TValue>> entries;
+    tree.ForEach([&entries](const TKey& key, const TValue& value) {
+        entries.emplace_back(key, value);
+        return true;
+    });
+    return entries;
+}
+
+template <typename TKey, typename TValue>
+std::vector<std::pair<TKey, TValue>> EntriesFrom(const AdaptiveRadixTree<TKey, TValue>& tree,
+                                                 const TKey& key)
+{
+    std::vector<std::pair<TKey, TValue>> entries;
+    tree.ForEachFrom(key, [&entries](const TKey& key, const TValue& value) {
+        entries.emplace_back(key, value);
+        return true;
+    });
+    return entries;
+}
+
+std::string RandomString(std::mt19937& random)
+{
+    // A small alphabet and short lengths produce many shared prefixes.
+    static const std::string kAlphabet("ab\0c", 4);
+    std::uniform_int_distribution<std::size_t> length(0, 6);
+    std::uniform_int_distribution<std::size_t> letter(0, kAlphabet.size() - 1);
+    std::string result;
+    for (auto remaining = length(random); remaining > 0; --remaining)
+    { result.push_back(kAlphabet[letter(random)]); }
+    return result;
+}
+}  // namespace
+
+TEST(AdaptiveRadixTreeTest, EmptyTree)
+{
+    AdaptiveRadixTree<std::int64_t, int> tree;
+    EXPECT_TRUE(tree.Empty());
+    EXPECT_EQ(tree.Find(0), nullptr);
+    EXPECT_TRUE(Entries(tree).empty());
+    EXPECT_TRUE(EntriesFrom(tree, std::int64_t{0}).empty());
+}
+
+TEST(AdaptiveRadixTreeTest, InsertAndFind)
+{
+    AdaptiveRadixTree<std::int64_t, std::string> tree;
+    EXPECT_TRUE(tree.Insert(5, "five").second);
+    EXPECT_TRUE(tree.Insert(-5, "minus five").second);
+
+    const auto [existing, inserted] = tree.Insert(5, "other");
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(*existing, "five");
+
+    EXPECT_EQ(*tree.Find(5), "five");
+    EXPECT_EQ(*tree.Find(-5), "minus five");
+    EXPECT_EQ(tree.Find(6), nullptr);
+    EXPECT_EQ(tree.Size(), 2u);
+
+    *tree.Find(5) = "changed";
+    EXPECT_EQ(*tree.Find(5), "changed");
+}
+
+TEST(AdaptiveRadixTreeTest, NodesGrowThroughAllSizes)
+{
+    // Keys that share all bytes but the last put up to 256 children under one node.
+    AdaptiveRadixTree<std::uint32_t, std::uint32_t> tree;
+    std::map<std::uint32_t, std::uint32_t> expected;
+    for (std::uint32_t byte = 0; byte < 256; ++byte)
+    {
+        const auto key = 0x01020300u | ((byte * 37) % 256);
+        tree.Insert(key, byte);
+        expected.emplace(key, byte);
+
+        for (const auto& [expected_key, expected_value] : expected)
+        {
+            const auto found = tree.Find(expected_key);
+            ASSERT_NE(found, nullptr) << byte;
+            EXPECT_EQ(*found, expected_value);
+        }
+        EXPECT_EQ(tree.Find(0x01020400u), nullptr);
+        EXPECT_EQ(Entries(tree),
+                  (std::vector<std::pair<std::uint32_t, std::uint32_t>>(expected.begin(),
+                                                                        expected.end())));
+    }
+}
+
+TEST(AdaptiveRadixTreeTest, MemoryBytesFollowNodeGrowth)
+{
+    AdaptiveRadixTree<std::uint32_t, std::uint32_t> tree;
+    EXPECT_EQ(tree.MemoryBytes(), 0u);
+
+    tree.Insert(0x01020300u, 0);
+    const auto leaf_bytes = tree.MemoryBytes();
+    EXPECT_GE(leaf_bytes, 2 * sizeof(std::uint32_t));
+
+    // The leaves stay the same size, while the node above them grows through all four sizes.
+    std::vector<std::size_t> inner_bytes;
+    for (std::uint32_t byte = 1; byte < 256; ++byte)
+    {
+        tree.Insert(0x01020300u | byte, byte);
+        inner_bytes.push_back(tree.MemoryBytes() - (byte + 1) * leaf_bytes);
+    }
+    EXPECT_EQ(std::set<std::size_t>(inner_bytes.begin(), inner_bytes.end()).size(), 4u);
+    EXPECT_TRUE(std::is_sorted(inner_bytes.begin(), inner_bytes.end()));
+
+    tree.Insert(0x01020300u, 1);
+    EXPECT_EQ(tree.MemoryBytes(), 256 * leaf_bytes + inner_bytes.back());
+
+    tree.Clear();
+    EXPECT_EQ(tree.MemoryBytes(), 0u);
+}
+
+TEST(AdaptiveRadixTreeTest, MatchesOrderedMapOnIntegers)
+{
+    std::mt19937 random(1);
+    std::uniform_int_distribution<std::int64_t> distribution(-100000, 100000);
+
+    AdaptiveRadixTree<std::int64_t, std::int64_t> tree;
+    std::map<std::int64_t, std::int64_t> expected;
+    for (int insertion = 0; insertion < 20000; ++insertion)
+    {
+        const auto key = distribution(random);
+        EXPECT_EQ(tree.Insert(key, insertion).second, expected.emplace(key, insertion).second);
+    }
+
+    EXPECT_EQ(tree.Size(), expected.size());
+    EXPECT_EQ(Entries(tree),
+              (std::vector<std::pair<std::int64_t, std::int64_t>>(expected.begin(),
+                                                                  expected.end())));
+    for (int lookup = 0; lookup < 1000; ++lookup)
+    {
+        const auto key = distribution(random);
+        const auto found = tree.Find(key);
+        const auto it = expected.find(key);
+        ASSERT_EQ(found != nullptr, it != expected.end());
+        if (found)
+        {
+            EXPECT_EQ(*found, it->second);
+        }
+    }
+}
+
+TEST(AdaptiveRadixTreeTest, MatchesOrderedMapOnStrings)
+{
+    std::mt19937 random(2);
+
+    AdaptiveRadixTree<std::string, int> tree;
+    std::map<std::string, int> expected;
+    for (int insertion = 0; insertion < 3000; ++insertion)
+    {
+        const auto key = RandomString(random);
+        EXPECT_EQ(tree.Insert(key, insertion).second, expected.emplace(key, insertion).second);
+    }
+
+    EXPECT_EQ(Entries(tree),
+              (std::vector<std::pair<std::string, int>>(expected.begin(), expected.end())));
+    for (int lookup = 0; lookup < 300; ++lookup)
+    {
+        const auto key = RandomString(random);
+        const auto found = tree.Find(key);
+        ASSERT_EQ(found != nullptr, expected.count(key) == 1) << key;
+
+        EXPECT_EQ(EntriesFrom(tree, key),
+                  (std::vector<std::pair<std::string, int>>(expected.lower_bound(key),
+                                                            expected.end())))
+            << key;
+    }
+}
+
+TEST(AdaptiveRadixTreeTest, ForEachFromStopsWhenVisitorReturnsFalse)
+{
+    AdaptiveRadixTree<std::int64_t, int> tree;
+    for (std::int64_t key = 0; key < 100; key += 10) { tree.Insert(key, 0); }
+
+    std::vector<std::int64_t> visited;
+    EXPECT_FALSE(tree.ForEachFrom(25, [&visited](std::int64_t key, int) {
+        visited.push_back(key);
+        return visited.size() < 3;
+    }));
+    EXPECT_EQ(visited, (std::vector<std::int64_t>{30, 40, 50}));
+}
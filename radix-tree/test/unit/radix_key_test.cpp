@@ -0,0 +1,72 @@
+#include <data-structures/radix-tree/radix_key.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace
+{
+template <typename TKey>
+void ExpectOrderPreserved(std::vector<TKey> keys)
+{
+    std::sort(keys.begin(), keys.end());
+    for (std::size_t index = 1; index < keys.size(); ++index)
+    {
+        const auto lower = EncodeRadixKey(keys[index - 1]);
+        const auto upper = EncodeRadixKey(keys[index]);
+        EXPECT_LT(lower, upper) << index;
+        // No encoded key is a prefix of another one.
+        EXPECT_NE(upper.compare(0, lower.size(), lower), 0) << index;
+    }
+}
+
+struct CompositeKey
+{
+    std::uint16_t major;
+    std::uint16_t minor;
+
+    void AppendRadixKey(std::string& out) const
+    {
+        RadixKey<std::uint16_t>::Append(out, major);
+        RadixKey<std::uint16_t>::Append(out, minor);
+    }
+};
+}  // namespace
+
+TEST(RadixKeyTest, SignedIntegers)
+{
+    ExpectOrderPreserved<std::int64_t>({std::numeric_limits<std::int64_t>::min(),
+                                        -1000000,
+                                        -256,
+                                        -1,
+                                        0,
+                                        1,
+                                        255,
+                                        256,
+                                        1000000,
+                                        std::numeric_limits<std::int64_t>::max()});
+    EXPECT_EQ(EncodeRadixKey(std::int32_t{0}), std::string("\x80\0\0\0", 4));
+}
+
+TEST(RadixKeyTest, UnsignedIntegers)
+{
+    ExpectOrderPreserved<std::uint32_t>({0, 1, 255, 256, 65535, 65536, 0xFFFFFFFF});
+    EXPECT_EQ(EncodeRadixKey(std::uint16_t{0x1234}), "\x12\x34");
+}
+
+TEST(RadixKeyTest, Strings)
+{
+    using namespace std::string_literals;
+    ExpectOrderPreserved<std::string>(
+        {""s, "\0"s, "\0\0"s, "\0a"s, "a"s, "a\0"s, "a\0b"s, "a\1"s, "ab"s, "abc"s, "b"s, "\xFF"s});
+}
+
+TEST(RadixKeyTest, MemberEncoding)
+{
+    EXPECT_EQ(EncodeRadixKey(CompositeKey{1, 2}), std::string("\0\1\0\2", 4));
+    EXPECT_LT(EncodeRadixKey(CompositeKey{1, 0xFFFF}), EncodeRadixKey(CompositeKey{2, 0}));
+}
@@ -0,0 +1,99 @@
+#include <data-structures/concurrency/task.hpp>
+#include <data-structures/concurrency/work_stealing_thread_pool.hpp>
+#include <data-structures/sstable-logger/async_ss_table_logger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Logger = SSTableLogger<std::int64_t>;
+using AsyncLogger = AsyncSSTableLogger<Logger>;
+
+constexpr std::int64_t kEntries = 1 << 16;
+constexpr std::int64_t kRuns = 8;
+constexpr std::int64_t kLookups = 1 << 12;
+
+/**
+ * Logs kEntries entries into kRuns runs, so that a lookup searches several runs.
+ */
+template <typename TLog, typename TFlush>
+void Fill(TLog log, TFlush flush)
+{
+    for (std::int64_t key = 0; key < kEntries; ++key)
+    {
+        log(key);
+        if ((key + 1) % (kEntries / kRuns) == 0)
+        {
+            flush();
+        }
+    }
+}
+
+std::vector<std::int64_t> MakeLookups()
+{
+    std::mt19937_64 random(42);
+    std::uniform_int_distribution<std::int64_t> key(0, kEntries - 1);
+    std::vector<std::int64_t> lookups(kLookups);
+    std::generate(lookups.begin(), lookups.end(), [&] { return key(random); });
+    return lookups;
+}
+
+/**
+ * Looks up every depth-th key of lookups, starting from first, one lookup at a time.
+ */
+Task<std::int64_t> Client(AsyncLogger& logger,
+                          const std::vector<std::int64_t>& lookups,
+                          std::size_t first,
+                          std::size_t depth)
+{
+    std::int64_t found = 0;
+    for (auto index = first; index < lookups.size(); index += depth)
+    { found += (co_await logger.RetrieveAsync(lookups[index])).has_value(); }
+    co_return found;
+}
+}  // namespace
+
+static void BM_RetrieveSync(benchmark::State& state)
+{
+    Logger logger;
+    Fill([&](std::int64_t key) { logger.Log(key, key); }, [&] { logger.Flush(); });
+    const auto lookups = MakeLookups();
+
+    for (auto _ : state)
+    {
+        for (const auto key : lookups) { benchmark::DoNotOptimize(logger.Retrieve(key)); }
+    }
+    state.SetItemsProcessed(state.iterations() * kLookups);
+}
+BENCHMARK(BM_RetrieveSync);
+
+/**
+ * Keeps depth lookups outstanding at all times, with depth clients that each wait for their lookup
+ * before issuing the next one.
+ */
+static void BM_RetrieveAsync(benchmark::State& state)
+{
+    WorkStealingThreadPool pool(std::max(1u, std::thread::hardware_concurrency()));
+    AsyncLogger logger(pool);
+    Fill([&](std::int64_t key) { SyncWait(logger.LogAsync(key, key)); },
+         [&] { SyncWait(logger.FlushAsync()); });
+    const auto lookups = MakeLookups();
+    const auto depth = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::vector<Task<std::int64_t>> clients;
+        for (std::size_t first = 0; first < depth; ++first)
+        { clients.push_back(Client(logger, lookups, first, depth)); }
+        benchmark::DoNotOptimize(SyncWaitAll(std::move(clients)));
+    }
+    state.SetItemsProcessed(state.iterations() * kLookups);
+}
+BENCHMARK(BM_RetrieveAsync)->ArgName("depth")->RangeMultiplier(16)->Range(1, 256)->UseRealTime();
@@ -0,0 +1,91 @@
+#include <data-structures/sstable-logger/ss_table_logger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+using Logger = SSTableLogger<std::int64_t>;
+using StringBSTLogger = BasicSSTableLogger<std::string, BSTMemtable, int>;
+using StringARTLogger = BasicSSTableLogger<std::string, ARTMemtable, int>;
+
+/**
+ * Timestamps 0..size-1, each displaced by up to displacement positions.
+ */
+std::vector<Logger::KeyType> MakeTimestamps(std::int64_t size, std::int64_t displacement)
+{
+    std::vector<Logger::KeyType> timestamps(size);
+    std::iota(timestamps.begin(), timestamps.end(), 0);
+    if (displacement > 1)
+    {
+        std::mt19937 random(42);
+        for (auto it = timestamps.begin(); std::distance(it, timestamps.end()) >= displacement;
+             it += displacement)
+        { std::shuffle(it, it + displacement, random); }
+    }
+    return timestamps;
+}
+}  // namespace
+
+static void BM_LogTimestamps(benchmark::State& state)
+{
+    const auto timestamps = MakeTimestamps(state.range(0), state.range(1));
+    for (auto _ : state)
+    {
+        Logger logger;
+        for (const auto timestamp : timestamps) { logger.Log(timestamp, timestamp); }
+        benchmark::DoNotOptimize(logger);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LogTimestamps)
+    ->ArgNames({"entries", "displacement"})
+    ->ArgsProduct({{1 << 10, 1 << 14}, {1, 4, 16}});
+
+/**
+ * Retrieves random timestamps from a logger whose entries are all in the memtable, which is built
+ * by the in-order appends that BM_LogTimestamps measures.
+ */
+static void BM_RetrieveTimestamps(benchmark::State& state)
+{
+    const auto timestamps = MakeTimestamps(state.range(0), state.range(1));
+    Logger logger;
+    for (const auto timestamp : timestamps) { logger.Log(timestamp, timestamp); }
+
+    std::mt19937 random(7);
+    std::uniform_int_distribution<Logger::KeyType> timestamp(0, state.range(0) - 1);
+    for (auto _ : state) { benchmark::DoNotOptimize(logger.Retrieve(timestamp(random))); }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RetrieveTimestamps)
+    ->ArgNames({"entries", "displacement"})
+    ->ArgsProduct({{1 << 10, 1 << 14}, {1, 4, 16}});
+
+template <typename TLogger>
+static void BM_LogAndRetrieveStrings(benchmark::State& state)
+{
+    std::mt19937 random(42);
+    std::vector<typename TLogger::KeyType> keys;
+    for (std::int64_t index = 0; index < state.range(0); ++index)
+    {
+        keys.push_back("service/host-" + std::to_string(index % 16) + "/" +
+                       std::to_string(index));
+    }
+    std::shuffle(keys.begin(), keys.end(), random);
+
+    for (auto _ : state)
+    {
+        TLogger logger;
+        for (const auto& key : keys) { logger.Log(key, 0); }
+        for (const auto& key : keys) { benchmark::DoNotOptimize(logger.Retrieve(key)); }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_LogAndRetrieveStrings, StringBSTLogger)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_LogAndRetrieveStrings, StringARTLogger)->Arg(1 << 14);
@@ -0,0 +1,63 @@
+#include <data-structures/sstable-logger/memory_budget.hpp>
+#include <data-structures/sstable-logger/ss_table_logger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace
+{
+using Logger = SSTableLogger<std::string>;
+
+constexpr std::int64_t kEntries = 1 << 15;
+}  // namespace
+
+/**
+ * Logs a burst of entries with 100-byte payloads into a logger with a memory budget of the given
+ * size in KiB, or none if zero, without ever flushing explicitly.
+ */
+static void BM_LogBurstWithBudget(benchmark::State& state)
+{
+    const std::string payload(100, 'x');
+    MemoryBudgetStats total;
+    std::uint64_t peak_memtable = 0;
+    std::uint64_t run_bytes = 0;
+    for (auto _ : state)
+    {
+        Logger::Options options;
+        if (state.range(0) > 0)
+        {
+            options.memory_budget =
+                std::make_shared<MemoryBudget>(static_cast<std::uint64_t>(state.range(0)) << 10);
+        }
+        Logger logger(options);
+        for (std::int64_t key = 0; key < kEntries; ++key)
+        {
+            logger.Log(key, payload);
+            peak_memtable = std::max(peak_memtable, logger.MemtableBytes());
+        }
+        run_bytes = logger.RunBytes();
+        if (options.memory_budget)
+        {
+            const auto stats = options.memory_budget->Stats();
+            total.throttled_writes += stats.throttled_writes;
+            total.throttle_ns += stats.throttle_ns;
+            total.stalled_writes += stats.stalled_writes;
+            total.stall_ns += stats.stall_ns;
+        }
+        benchmark::DoNotOptimize(logger);
+    }
+
+    const auto iterations = static_cast<double>(state.iterations());
+    state.SetItemsProcessed(state.iterations() * kEntries);
+    state.counters["peak_memtable_KiB"] = static_cast<double>(peak_memtable) / 1024;
+    state.counters["run_KiB"] = static_cast<double>(run_bytes) / 1024;
+    state.counters["throttled_writes"] = static_cast<double>(total.throttled_writes) / iterations;
+    state.counters["throttle_ms"] = static_cast<double>(total.throttle_ns) / iterations / 1e6;
+    state.counters["stalled_writes"] = static_cast<double>(total.stalled_writes) / iterations;
+    state.counters["stall_ms"] = static_cast<double>(total.stall_ns) / iterations / 1e6;
+}
+BENCHMARK(BM_LogBurstWithBudget)->ArgName("budget_KiB")->Arg(0)->Arg(4096)->Arg(1024)->Arg(256)
+    ->UseRealTime();
@@ -0,0 +1,124 @@
+#include <data-structures/sstable-logger/ss_table_logger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+using IntegerLogger = SSTableLogger<int>;
+using StringBSTLogger = BasicSSTableLogger<std::string, BSTMemtable, int>;
+using StringARTLogger = BasicSSTableLogger<std::string, ARTMemtable, int>;
+
+constexpr std::size_t kLookups = 1 << 14;
+
+std::int64_t MakeKey(std::int64_t index, std::int64_t*)
+{
+    return index;
+}
+
+std::string MakeKey(std::int64_t index, std::string*)
+{
+    return "service/host-" + std::to_string(index % 16) + "/" + std::to_string(index);
+}
+
+/**
+ * Keys 0..size-1 in random order.
+ */
+template <typename TKey>
+std::vector<TKey> MakeKeys(std::int64_t size)
+{
+    std::vector<TKey> keys;
+    keys.reserve(size);
+    for (std::int64_t index = 0; index < size; ++index)
+    { keys.push_back(MakeKey(index, static_cast<TKey*>(nullptr))); }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+    return keys;
+}
+
+template <typename TKey>
+std::vector<TKey> SampleLookups(const std::vector<TKey>& keys)
+{
+    std::mt19937 random(7);
+    std::uniform_int_distribution<std::size_t> index(0, keys.size() - 1);
+    std::vector<TKey> lookups;
+    lookups.reserve(kLookups);
+    for (std::size_t lookup = 0; lookup < kLookups; ++lookup)
+    { lookups.push_back(keys[index(random)]); }
+    return lookups;
+}
+
+template <typename TLogger>
+TLogger MakeLogger(bool point_lookup_index)
+{
+    typename TLogger::Options options;
+    options.point_lookup_index = point_lookup_index;
+    return TLogger(options);
+}
+}  // namespace
+
+/**
+ * Logs entries under random keys. Argument 1 is whether the point lookup index is enabled.
+ */
+template <typename TLogger>
+static void BM_Log(benchmark::State& state)
+{
+    const auto keys = MakeKeys<typename TLogger::KeyType>(state.range(0));
+    for (auto _ : state)
+    {
+        auto logger = MakeLogger<TLogger>(state.range(1));
+        for (const auto& key : keys) { logger.Log(key, 0); }
+        benchmark::DoNotOptimize(logger);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Log, IntegerLogger)
+    ->ArgNames({"entries", "index"})
+    ->ArgsProduct({{1 << 12, 1 << 16}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_Log, StringBSTLogger)
+    ->ArgNames({"entries", "index"})
+    ->ArgsProduct({{1 << 12, 1 << 16}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_Log, StringARTLogger)
+    ->ArgNames({"entries", "index"})
+    ->ArgsProduct({{1 << 12, 1 << 16}, {0, 1}});
+
+/**
+ * Retrieves keys from a logger whose entries are all in the memtable, or, with argument 2 set,
+ * half in a flushed run and half in the memtable.
+ */
+template <typename TLogger>
+static void BM_Retrieve(benchmark::State& state)
+{
+    const auto keys = MakeKeys<typename TLogger::KeyType>(state.range(0));
+    const auto lookups = SampleLookups(keys);
+    auto logger = MakeLogger<TLogger>(state.range(1));
+    for (std::size_t index = 0; index < keys.size(); ++index)
+    {
+        if (state.range(2) && index == keys.size() / 2)
+        {
+            logger.Flush();
+        }
+        logger.Log(keys[index], 0);
+    }
+
+    for (auto _ : state)
+    {
+        for (const auto& key : lookups) { benchmark::DoNotOptimize(logger.Retrieve(key)); }
+    }
+    state.SetItemsProcessed(state.iterations() * kLookups);
+    state.counters["memtable_KiB"] = static_cast<double>(logger.MemtableBytes()) / 1024;
+}
+BENCHMARK_TEMPLATE(BM_Retrieve, IntegerLogger)
+    ->ArgNames({"entries", "index", "flushed"})
+    ->ArgsProduct({{1 << 12, 1 << 16}, {0, 1}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_Retrieve, StringBSTLogger)
+    ->ArgNames({"entries", "index", "flushed"})
+    ->ArgsProduct({{1 << 12, 1 << 16}, {0, 1}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_Retrieve, StringARTLogger)
+    ->ArgNames({"entries", "index", "flushed"})
+    ->ArgsProduct({{1 << 12, 1 << 16}, {0, 1}, {0, 1}});
@@ -0,0 +1,81 @@
+#include <data-structures/sstable-logger/partitioned_ss_table_logger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace
+{
+using Logger = SSTableLogger<std::int64_t>;
+
+constexpr std::int64_t kWindowWidth = 1 << 10;
+constexpr std::int64_t kWindows = 16;
+}  // namespace
+
+/**
+ * Expires the oldest window of timestamps by erasing its keys one by one and compacting.
+ */
+static void BM_RetentionByErase(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        Logger logger;
+        for (std::int64_t key = 0; key < kWindowWidth * kWindows; ++key) { logger.Log(key, key); }
+        logger.Flush();
+        state.ResumeTiming();
+
+        for (std::int64_t key = 0; key < kWindowWidth; ++key) { logger.Erase(key); }
+        logger.Flush();
+        logger.Compact();
+        benchmark::DoNotOptimize(logger);
+
+        state.PauseTiming();
+        logger = Logger();
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_RetentionByErase)->Iterations(50);
+
+/**
+ * Expires the oldest window of timestamps by dropping it.
+ */
+static void BM_RetentionByDrop(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        PartitionedSSTableLogger<Logger> logger(kWindowWidth);
+        for (std::int64_t key = 0; key < kWindowWidth * kWindows; ++key) { logger.Log(key, key); }
+        logger.Flush();
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(logger.DropWindowsBefore(kWindowWidth));
+
+        state.PauseTiming();
+        logger = PartitionedSSTableLogger<Logger>(kWindowWidth);
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_RetentionByDrop)->Iterations(50);
+
+template <typename TLogger>
+static void BM_ScanLastWindow(benchmark::State& state, TLogger logger)
+{
+    for (std::int64_t key = 0; key < kWindowWidth * kWindows; ++key) { logger.Log(key, key); }
+    logger.Flush();
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        logger.Scan(kWindowWidth * (kWindows - 1),
+                    kWindowWidth * kWindows,
+                    [&sum](std::int64_t, const Logger::EntryType& entry) {
+                        sum += std::get<0>(entry);
+                        return true;
+                    });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * kWindowWidth);
+}
+BENCHMARK_CAPTURE(BM_ScanLastWindow, single, Logger());
+BENCHMARK_CAPTURE(BM_ScanLastWindow, partitioned, PartitionedSSTableLogger<Logger>(kWindowWidth));
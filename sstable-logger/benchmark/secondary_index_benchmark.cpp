@@ -0,0 +1,57 @@
+#include <data-structures/sstable-logger/indexed_ss_table_logger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using Logger = IndexedSSTableLogger<SSTableLogger<int, int>, 0>;
+
+constexpr int kStatuses = 64;
+
+Logger MakeLogger(std::int64_t size)
+{
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> status(0, kStatuses - 1);
+    Logger logger;
+    for (std::int64_t key = 0; key < size; ++key) { logger.Log(key, status(random), 0); }
+    logger.Flush();
+    return logger;
+}
+}  // namespace
+
+static void BM_LookupByIndex(benchmark::State& state)
+{
+    auto logger = MakeLogger(state.range(0));
+    int status = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(logger.LookupEqual<0>(status));
+        status = (status + 1) % kStatuses;
+    }
+}
+BENCHMARK(BM_LookupByIndex)->Arg(1 << 12)->Arg(1 << 16);
+
+static void BM_LookupByScan(benchmark::State& state)
+{
+    auto logger = MakeLogger(state.range(0));
+    int status = 0;
+    for (auto _ : state)
+    {
+        std::vector<std::pair<Logger::KeyType, Logger::EntryType>> found;
+        for (std::int64_t key = 0; key < state.range(0); ++key)
+        {
+            if (auto entry = logger.Retrieve(key); entry && std::get<0>(*entry) == status)
+            {
+                found.emplace_back(key, std::move(*entry));
+            }
+        }
+        benchmark::DoNotOptimize(found);
+        status = (status + 1) % kStatuses;
+    }
+}
+BENCHMARK(BM_LookupByScan)->Arg(1 << 12)->Arg(1 << 16);
@@ -0,0 +1,115 @@
+#include <data-structures/sstable-logger/tailing_ss_table_logger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+/// Entries hold the time they were logged at, in nanoseconds of the steady clock.
+using Logger = TailingSSTableLogger<SSTableLogger<std::int64_t>>;
+
+constexpr std::int64_t kEntries = 1 << 14;
+constexpr std::size_t kCapacity = 1 << 10;
+constexpr std::size_t kBatch = 256;
+
+std::int64_t Now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+struct ConsumerResult
+{
+    std::int64_t received = 0;
+    std::int64_t total_latency = 0;
+    std::int64_t max_latency = 0;
+};
+}  // namespace
+
+/**
+ * Logs entries while subscribers on other threads receive them, from the first write to the last
+ * entry received. Reports the fraction of entries delivered and their end-to-end latency.
+ */
+static void BM_Tail(benchmark::State& state)
+{
+    const auto subscriber_count = static_cast<std::size_t>(state.range(0));
+    const auto backpressure = static_cast<Backpressure>(state.range(1));
+
+    ConsumerResult total;
+    std::uint64_t wakeups = 0;
+    for (auto _ : state)
+    {
+        auto logger = std::make_unique<Logger>();
+        std::vector<Logger::Subscription> subscriptions;
+        std::vector<ConsumerResult> results(subscriber_count);
+        std::vector<std::thread> consumers;
+        for (std::size_t index = 0; index < subscriber_count; ++index)
+        {
+            subscriptions.push_back(logger->Subscribe(0, kEntries, kCapacity, backpressure));
+            auto& subscription = *subscriptions.back();
+            auto& result = results[index];
+            consumers.emplace_back([&subscription, &result] {
+                std::vector<Logger::Event> events;
+                while (subscription.Receive(events, kBatch) > 0)
+                {
+                    const auto now = Now();
+                    for (const auto& event : events)
+                    {
+                        const auto latency = now - std::get<0>(*event.entry);
+                        result.total_latency += latency;
+                        result.max_latency = std::max(result.max_latency, latency);
+                    }
+                    result.received += static_cast<std::int64_t>(events.size());
+                    events.clear();
+                }
+            });
+        }
+
+        for (std::int64_t key = 0; key < kEntries; ++key) { logger->Log(key, Now()); }
+        logger.reset();
+        for (auto& consumer : consumers) { consumer.join(); }
+
+        for (const auto& result : results)
+        {
+            total.received += result.received;
+            total.total_latency += result.total_latency;
+            total.max_latency = std::max(total.max_latency, result.max_latency);
+        }
+        for (const auto& subscription : subscriptions)
+        { wakeups += subscription->Stats().receiver_wakeups; }
+    }
+
+    const auto published = static_cast<double>(state.iterations() * kEntries * subscriber_count);
+    state.SetItemsProcessed(state.iterations() * kEntries);
+    state.counters["delivered"] = static_cast<double>(total.received) / published;
+    state.counters["mean_latency_us"] =
+        total.received ? static_cast<double>(total.total_latency) / total.received / 1000 : 0;
+    state.counters["max_latency_us"] = static_cast<double>(total.max_latency) / 1000;
+    state.counters["wakeups_per_1k"] = static_cast<double>(wakeups) * 1000 / published;
+}
+BENCHMARK(BM_Tail)
+    ->ArgNames({"subscribers", "backpressure"})
+    ->ArgsProduct({{1, 4},
+                   {static_cast<std::int64_t>(Backpressure::kDrop),
+                    static_cast<std::int64_t>(Backpressure::kBlock),
+                    static_cast<std::int64_t>(Backpressure::kSpill)}})
+    ->UseRealTime();
+
+static void BM_LogWithoutSubscribers(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        Logger logger;
+        for (std::int64_t key = 0; key < kEntries; ++key) { logger.Log(key, key); }
+        benchmark::DoNotOptimize(logger);
+    }
+    state.SetItemsProcessed(state.iterations() * kEntries);
+}
+BENCHMARK(BM_LogWithoutSubscribers);
@@ -0,0 +1,163 @@
+#ifndef DATA_STRUCTURES_ASYNC_SS_TABLE_LOGGER_HPP
+#define DATA_STRUCTURES_ASYNC_SS_TABLE_LOGGER_HPP
+
+#include <data-structures/concurrency/task.hpp>
+#include <data-structures/concurrency/work_stealing_thread_pool.hpp>
+
+#include "ss_table_logger.hpp"
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+
+/**
+ * SSTableLogger with an asynchronous interface for callers that must not block, such as event
+ * loops. Every operation returns a lazily started Task that runs the operation on a worker of a
+ * thread pool when awaited, and resumes the awaiting coroutine on that worker when it completes.
+ *
+ * Lookups hold the logger in shared mode, so any number of them run in parallel, while writes,
+ * flushes and compactions hold it exclusively. Writes throttled or stalled by the memory budget
+ * wait before they take the lock, so that they do not hold up other operations meanwhile. Only
+ * the flush that relieves a stall holds the lock.
+ *
+ * The logger must outlive every task it returned.
+ *
+ * @tparam TLogger wrapped logger, an instantiation of BasicSSTableLogger
+ */
+template <typename TLogger>
+class AsyncSSTableLogger
+{
+public:
+    using LoggerType = TLogger;
+    using KeyType = typename TLogger::KeyType;
+    using EntryType = typename TLogger::EntryType;
+    using Options = typename TLogger::Options;
+
+    /**
+     * @param pool Pool that runs the operations.
+     * @param options Options of the wrapped logger.
+     */
+    explicit AsyncSSTableLogger(WorkStealingThreadPool& pool, Options options = {})
+        : pool_(pool), budget_(options.memory_budget), logger_(std::move(options))
+    {}
+
+    /**
+     * Retrieves the latest entry logged under key. See BasicSSTableLogger::Retrieve.
+     */
+    Task<std::optional<EntryType>> RetrieveAsync(KeyType key);
+
+    /**
+     * Logs an entry. See BasicSSTableLogger::Log.
+     * @note The arguments are taken by value, since they have to outlive the call.
+     */
+    template <typename... Args>
+    Task<> LogAsync(KeyType key, Args... args);
+
+    /**
+     * Erases the entry logged under key. See BasicSSTableLogger::Erase.
+     */
+    Task<> EraseAsync(KeyType key);
+
+    /**
+     * Merges an entry into the one logged under key. See BasicSSTableLogger::Merge.
+     */
+    template <typename... Args>
+    Task<> MergeAsync(KeyType key, Args... args);
+
+    /**
+     * Freezes the memtable into a new sorted run. See BasicSSTableLogger::Flush.
+     */
+    Task<> FlushAsync();
+
+    /**
+     * Merges all runs into one. See BasicSSTableLogger::Compact.
+     */
+    Task<> CompactAsync();
+
+    /**
+     * @return Statistics of the wrapped logger, see BasicSSTableLogger::Stats.
+     */
+    SSTableLoggerStats Stats() const
+    {
+        std::shared_lock lock(mutex_);
+        return logger_.Stats();
+    }
+
+private:
+    /**
+     * Throttles or stalls the calling worker ahead of a write, see MemoryBudget::AdmitWriteAhead.
+     */
+    void AdmitWrite()
+    {
+        if (budget_)
+        {
+            budget_->AdmitWriteAhead([this] {
+                std::unique_lock lock(mutex_);
+                logger_.Flush();
+            });
+        }
+    }
+
+    WorkStealingThreadPool& pool_;
+    std::shared_ptr<MemoryBudget> budget_;
+    mutable std::shared_mutex mutex_;
+    TLogger logger_;
+};
+
+template <typename TLogger>
+Task<std::optional<typename AsyncSSTableLogger<TLogger>::EntryType>>
+AsyncSSTableLogger<TLogger>::RetrieveAsync(KeyType key)
+{
+    co_await ScheduleOn(pool_);
+    std::shared_lock lock(mutex_);
+    co_return logger_.Retrieve(std::move(key));
+}
+
+template <typename TLogger>
+template <typename... Args>
+Task<> AsyncSSTableLogger<TLogger>::LogAsync(KeyType key, Args... args)
+{
+    co_await ScheduleOn(pool_);
+    AdmitWrite();
+    std::unique_lock lock(mutex_);
+    logger_.Log(std::move(key), std::move(args)...);
+}
+
+template <typename TLogger>
+Task<> AsyncSSTableLogger<TLogger>::EraseAsync(KeyType key)
+{
+    co_await ScheduleOn(pool_);
+    AdmitWrite();
+    std::unique_lock lock(mutex_);
+    logger_.Erase(std::move(key));
+}
+
+template <typename TLogger>
+template <typename... Args>
+Task<> AsyncSSTableLogger<TLogger>::MergeAsync(KeyType key, Args... args)
+{
+    co_await ScheduleOn(pool_);
+    AdmitWrite();
+    std::unique_lock lock(mutex_);
+    logger_.Merge(std::move(key), std::move(args)...);
+}
+
+template <typename TLogger>
+Task<> AsyncSSTableLogger<TLogger>::FlushAsync()
+{
+    co_await ScheduleOn(pool_);
+    std::unique_lock lock(mutex_);
+    logger_.Flush();
+}
+
+template <typename TLogger>
+Task<> AsyncSSTableLogger<TLogger>::CompactAsync()
+{
+    co_await ScheduleOn(pool_);
+    std::unique_lock lock(mutex_);
+    logger_.Compact();
+}
+
+#endif  // DATA_STRUCTURES_ASYNC_SS_TABLE_LOGGER_HPP
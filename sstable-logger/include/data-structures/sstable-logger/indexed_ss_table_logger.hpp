@@ -0,0 +1,328 @@
+#ifndef DATA_STRUCTURES_INDEXED_SS_TABLE_LOGGER_HPP
+#define DATA_STRUCTURES_INDEXED_SS_TABLE_LOGGER_HPP
+
+#include "ss_table_logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/**
+ * SSTableLogger with secondary indexes on the entry fields at positions Indices, which allow
+ * looking entries up by the value of a field instead of by key.
+ *
+ * An index maps field values to the keys of the entries logged with them. It is maintained
+ * incrementally on every write, without reading the logger, and is allowed to hold stale pairs,
+ * left behind when an entry is overwritten, erased or expires. Lookups check every candidate key
+ * against the latest entry logged under it and drop the stale pairs they meet, and Compact drops
+ * all of them.
+ *
+ * @tparam TLogger logger to index, an instantiation of BasicSSTableLogger
+ * @tparam Indices positions of the indexed fields in TLogger::EntryType, each of them totally
+ * ordered
+ */
+template <typename TLogger, std::size_t... Indices>
+class IndexedSSTableLogger
+{
+public:
+    using LoggerType = TLogger;
+    using KeyType = typename TLogger::KeyType;
+    using EntryType = typename TLogger::EntryType;
+    using Options = typename TLogger::Options;
+    using Snapshot = typename TLogger::Snapshot;
+
+    template <std::size_t I>
+    using FieldType = std::tuple_element_t<I, EntryType>;
+
+    static_assert(sizeof...(Indices) > 0, "IndexedSSTableLogger needs at least one index");
+    static_assert(((Indices < std::tuple_size_v<EntryType>) && ...), "Index out of range");
+    static_assert((std::totally_ordered<FieldType<Indices>> && ...),
+                  "Indexed fields must be totally ordered");
+
+    /**
+     * WriteBatch of the underlying logger that also remembers which entries to index.
+     */
+    class WriteBatch
+    {
+    public:
+        template <typename... Args>
+        void Log(KeyType key, Args&&... args)
+        {
+            batch_.Log(key, args...);
+            logged_.emplace_back(std::move(key), EntryType(std::forward<Args>(args)...));
+        }
+
+        void Erase(KeyType key)
+        {
+            batch_.Erase(std::move(key));
+        }
+
+        template <typename... Args>
+        void Merge(KeyType key, Args&&... args)
+        {
+            batch_.Merge(key, std::forward<Args>(args)...);
+            merged_.push_back(std::move(key));
+        }
+
+    private:
+        friend IndexedSSTableLogger;
+
+        typename TLogger::WriteBatch batch_;
+        std::vector<std::pair<KeyType, EntryType>> logged_;
+        std::vector<KeyType> merged_;
+    };
+
+    IndexedSSTableLogger() = default;
+
+    explicit IndexedSSTableLogger(Options options) : logger_(std::move(options)) {}
+
+    /**
+     * Logs an entry and indexes its fields. See BasicSSTableLogger::Log.
+     */
+    template <typename... Args>
+    void Log(KeyType key, Args&&... args);
+
+    /**
+     * Erases the entry logged under key. Its index pairs become stale.
+     */
+    void Erase(KeyType key);
+
+    /**
+     * Merges an entry into the one logged under key and indexes the result, which is read back
+     * from the logger. See BasicSSTableLogger::Merge.
+     */
+    template <typename... Args>
+    void Merge(KeyType key, Args&&... args);
+
+    /**
+     * Applies all writes in the batch and indexes the entries it logs and merges into.
+     */
+    void Write(WriteBatch batch);
+
+    std::optional<EntryType> Retrieve(KeyType key)
+    {
+        return logger_.Retrieve(std::move(key));
+    }
+
+    std::optional<EntryType> Retrieve(KeyType key, const Snapshot& snapshot)
+    {
+        return logger_.Retrieve(std::move(key), snapshot);
+    }
+
+    Snapshot GetSnapshot()
+    {
+        return logger_.GetSnapshot();
+    }
+
+    void ReleaseSnapshot(const Snapshot& snapshot)
+    {
+        logger_.ReleaseSnapshot(snapshot);
+    }
+
+    void Flush()
+    {
+        logger_.Flush();
+    }
+
+    /**
+     * Compacts the logger and drops the stale pairs from all indexes.
+     */
+    void Compact();
+
+    /**
+     * Finds the latest entries whose field I equals value.
+     * @return Keys and entries, ordered by key.
+     */
+    template <std::size_t I>
+    std::vector<std::pair<KeyType, EntryType>> LookupEqual(const FieldType<I>& value);
+
+    /**
+     * Finds the latest entries whose field I lies in [lo, hi).
+     * @return Keys and entries, ordered by the field and then by key.
+     */
+    template <std::size_t I>
+    std::vector<std::pair<KeyType, EntryType>> LookupRange(const FieldType<I>& lo,
+                                                           const FieldType<I>& hi);
+
+    /**
+     * @return Number of pairs in the index on field I, including stale ones.
+     */
+    template <std::size_t I>
+    std::size_t IndexSize() const
+    {
+        return Index<I>().size();
+    }
+
+private:
+    /**
+     * Orders the pairs of the index on field I by field and then by key, and also compares them
+     * with bare field values, so that lookups by field need no key.
+     */
+    template <std::size_t I>
+    struct IndexOrder
+    {
+        using is_transparent = void;
+        using Pair = std::pair<FieldType<I>, KeyType>;
+
+        bool operator()(const Pair& lhs, const Pair& rhs) const
+        {
+            return lhs < rhs;
+        }
+
+        bool operator()(const Pair& lhs, const FieldType<I>& rhs) const
+        {
+            return lhs.first < rhs;
+        }
+
+        bool operator()(const FieldType<I>& lhs, const Pair& rhs) const
+        {
+            return lhs < rhs.first;
+        }
+    };
+
+    template <std::size_t I>
+    using IndexType = std::set<typename IndexOrder<I>::Pair, IndexOrder<I>>;
+
+    template <std::size_t I>
+    static constexpr std::size_t Position()
+    {
+        constexpr std::array<std::size_t, sizeof...(Indices)> indices{Indices...};
+        constexpr auto position = static_cast<std::size_t>(
+            std::find(indices.begin(), indices.end(), I) - indices.begin());
+        static_assert(position < sizeof...(Indices), "Field I is not indexed");
+        return position;
+    }
+
+    template <std::size_t I>
+    IndexType<I>& Index()
+    {
+        return std::get<Position<I>()>(indexes_);
+    }
+
+    template <std::size_t I>
+    const IndexType<I>& Index() const
+    {
+        return std::get<Position<I>()>(indexes_);
+    }
+
+    void AddToIndexes(const KeyType& key, const EntryType& entry)
+    {
+        (Index<Indices>().emplace(std::get<Indices>(entry), key), ...);
+    }
+
+    /**
+     * Erases the stale pairs in [first, last) of the index on field I.
+     * @param current If not null, receives the keys and entries of the pairs that are current.
+     */
+    template <std::size_t I>
+    void Validate(typename IndexType<I>::iterator first,
+                  typename IndexType<I>::iterator last,
+                  std::vector<std::pair<KeyType, EntryType>>* current);
+
+    TLogger logger_;
+    std::tuple<IndexType<Indices>...> indexes_;
+};
+
+template <typename TLogger, std::size_t... Indices>
+template <typename... Args>
+void IndexedSSTableLogger<TLogger, Indices...>::Log(KeyType key, Args&&... args)
+{
+    // The entry is indexed before the arguments are moved into the logger.
+    AddToIndexes(key, EntryType(args...));
+    logger_.Log(std::move(key), std::forward<Args>(args)...);
+}
+
+template <typename TLogger, std::size_t... Indices>
+void IndexedSSTableLogger<TLogger, Indices...>::Erase(KeyType key)
+{
+    logger_.Erase(std::move(key));
+}
+
+template <typename TLogger, std::size_t... Indices>
+template <typename... Args>
+void IndexedSSTableLogger<TLogger, Indices...>::Merge(KeyType key, Args&&... args)
+{
+    logger_.Merge(key, std::forward<Args>(args)...);
+    if (const auto merged = logger_.Retrieve(key))
+    {
+        AddToIndexes(key, *merged);
+    }
+}
+
+template <typename TLogger, std::size_t... Indices>
+void IndexedSSTableLogger<TLogger, Indices...>::Write(WriteBatch batch)
+{
+    for (const auto& [key, entry] : batch.logged_) { AddToIndexes(key, entry); }
+    logger_.Write(std::move(batch.batch_));
+    for (const auto& key : batch.merged_)
+    {
+        if (const auto merged = logger_.Retrieve(key))
+        {
+            AddToIndexes(key, *merged);
+        }
+    }
+}
+
+template <typename TLogger, std::size_t... Indices>
+void IndexedSSTableLogger<TLogger, Indices...>::Compact()
+{
+    logger_.Compact();
+    (Validate<Indices>(Index<Indices>().begin(), Index<Indices>().end(), nullptr), ...);
+}
+
+template <typename TLogger, std::size_t... Indices>
+template <std::size_t I>
+std::vector<std::pair<typename IndexedSSTableLogger<TLogger, Indices...>::KeyType,
+                      typename IndexedSSTableLogger<TLogger, Indices...>::EntryType>>
+IndexedSSTableLogger<TLogger, Indices...>::LookupEqual(const FieldType<I>& value)
+{
+    const auto [first, last] = Index<I>().equal_range(value);
+    std::vector<std::pair<KeyType, EntryType>> current;
+    Validate<I>(first, last, &current);
+    return current;
+}
+
+template <typename TLogger, std::size_t... Indices>
+template <std::size_t I>
+std::vector<std::pair<typename IndexedSSTableLogger<TLogger, Indices...>::KeyType,
+                      typename IndexedSSTableLogger<TLogger, Indices...>::EntryType>>
+IndexedSSTableLogger<TLogger, Indices...>::LookupRange(const FieldType<I>& lo,
+                                                       const FieldType<I>& hi)
+{
+    auto& index = Index<I>();
+    std::vector<std::pair<KeyType, EntryType>> current;
+    Validate<I>(index.lower_bound(lo), index.lower_bound(hi), &current);
+    return current;
+}
+
+template <typename TLogger, std::size_t... Indices>
+template <std::size_t I>
+void IndexedSSTableLogger<TLogger, Indices...>::Validate(
+    typename IndexType<I>::iterator first,
+    typename IndexType<I>::iterator last,
+    std::vector<std::pair<KeyType, EntryType>>* current)
+{
+    auto& index = Index<I>();
+    while (first != last)
+    {
+        auto entry = logger_.Retrieve(first->second);
+        if (!entry || !(std::get<I>(*entry) == first->first))
+        {
+            first = index.erase(first);
+            continue;
+        }
+        if (current)
+        {
+            current->emplace_back(first->second, std::move(*entry));
+        }
+        ++first;
+    }
+}
+
+#endif  // DATA_STRUCTURES_INDEXED_SS_TABLE_LOGGER_HPP
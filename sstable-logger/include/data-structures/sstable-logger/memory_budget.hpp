@@ -0,0 +1,375 @@
+#ifndef DATA_STRUCTURES_MEMORY_BUDGET_HPP
+#define DATA_STRUCTURES_MEMORY_BUDGET_HPP
+
+#include <data-structures/instrumentation/stats.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+struct MemoryBudgetStats
+{
+    std::uint64_t limit = 0;
+    /// Bytes of the memtables, which count towards the limit.
+    std::uint64_t used = 0;
+    /// Highest usage so far.
+    std::uint64_t peak = 0;
+    /// Bytes of the runs, which do not count towards the limit.
+    std::uint64_t run_bytes = 0;
+
+    /// Writes delayed because usage was above the slowdown threshold, and the time writers slept
+    /// for them.
+    std::uint64_t throttled_writes = 0;
+    std::uint64_t throttle_ns = 0;
+    /// Writes stalled because usage reached the limit, counted as they stall, and their total
+    /// stall time, counted as they go ahead.
+    std::uint64_t stalled_writes = 0;
+    std::uint64_t stall_ns = 0;
+    /// Stalled writes that gave up waiting after MemoryBudget::Options::max_stall, and went ahead
+    /// over the limit.
+    std::uint64_t stall_timeouts = 0;
+};
+
+/**
+ * Memory budget shared by any number of loggers, possibly on different threads, which reserve
+ * the bytes of their memtables from it and report the bytes of their runs to it.
+ *
+ * Only the memtables count towards the limit. They are what a logger can free on demand, by
+ * flushing, while runs only shrink as their entries are erased or expire. Counting the runs as
+ * well would stall every write for good once they fill the budget.
+ *
+ * Writes are admitted in three stages. Below the slowdown threshold they go ahead at full speed.
+ * Above it, each write is delayed, by more the closer usage gets to the limit, so that writers
+ * slow down gradually instead of hitting a wall. Once the limit is reached, a write stalls: its
+ * logger flushes its memtable, and then the write waits until other loggers release enough
+ * memory, for at most Options::max_stall.
+ */
+class MemoryBudget
+{
+public:
+    struct Options
+    {
+        /// Fraction of the limit above which writes are delayed.
+        double slowdown_ratio = 0.8;
+        /// Delay of a write just below the limit. The delay grows linearly from zero at the
+        /// slowdown threshold.
+        std::chrono::nanoseconds max_delay = std::chrono::microseconds(10);
+        /// Delays are added up for every writing thread separately, and slept off by the thread
+        /// once they reach this quantum, since sleeps much shorter than a scheduler tick overshoot.
+        std::chrono::nanoseconds sleep_quantum = std::chrono::milliseconds(1);
+        /// Longest time a write waits for memory once the limit is reached.
+        std::chrono::nanoseconds max_stall = std::chrono::milliseconds(100);
+    };
+
+    explicit MemoryBudget(std::uint64_t limit) : MemoryBudget(limit, Options()) {}
+
+    MemoryBudget(std::uint64_t limit, Options options)
+        : limit_(limit),
+          slowdown_threshold_(static_cast<std::uint64_t>(static_cast<double>(limit) *
+                                                         options.slowdown_ratio)),
+          options_(options)
+    {}
+
+    /// What reserved bytes are held by.
+    enum class Usage
+    {
+        /// Memtables, counted towards the limit.
+        kMemtable,
+        /// Runs, only reported.
+        kRun
+    };
+
+    void Reserve(std::uint64_t bytes, Usage usage = Usage::kMemtable);
+
+    void Release(std::uint64_t bytes, Usage usage = Usage::kMemtable);
+
+    std::uint64_t Limit() const
+    {
+        return limit_;
+    }
+
+    /**
+     * @return Bytes of the memtables, which count towards the limit.
+     */
+    std::uint64_t Used() const
+    {
+        return used_.load();
+    }
+
+    std::uint64_t RunBytes() const
+    {
+        return run_bytes_.load(std::memory_order_relaxed);
+    }
+
+    bool Exhausted() const
+    {
+        return Used() >= limit_;
+    }
+
+    /**
+     * @return Delay of a write at the current usage, or zero below the slowdown threshold and at
+     * the limit, where writes stall instead.
+     */
+    std::chrono::nanoseconds WriteDelay() const;
+
+    /**
+     * Throttles or stalls a write according to the current usage, unless the write was admitted
+     * ahead by AdmitWriteAhead.
+     * @param relieve Frees memory held by the writer, such as by flushing its memtable. Called
+     * when the write stalls.
+     */
+    template <typename TRelieve>
+    void AdmitWrite(TRelieve&& relieve);
+
+    /**
+     * Admits a write ahead of it, as AdmitWrite does. The next AdmitWrite of the calling thread on
+     * this budget then goes ahead at once, so that writers that hold a lock while they write can
+     * be throttled and stalled before they take it. The write may then find the budget exhausted
+     * again by other writers, and go ahead over the limit.
+     */
+    template <typename TRelieve>
+    void AdmitWriteAhead(TRelieve&& relieve);
+
+    MemoryBudgetStats Stats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static std::uint64_t Nanoseconds(Clock::duration duration)
+    {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    }
+
+    /**
+     * Adds the delay of a write to the debt of the calling thread, and sleeps the debt off once
+     * it reaches the quantum.
+     */
+    void Delay();
+
+    const std::uint64_t limit_;
+    const std::uint64_t slowdown_threshold_;
+    const Options options_;
+
+    std::atomic<std::uint64_t> used_{0};
+    std::atomic<std::uint64_t> peak_{0};
+    std::atomic<std::uint64_t> run_bytes_{0};
+
+    std::mutex mutex_;
+    std::condition_variable released_;
+    std::atomic<std::uint32_t> waiters_{0};
+
+    std::atomic<std::uint64_t> throttled_writes_{0};
+    std::atomic<std::uint64_t> throttle_ns_{0};
+    std::atomic<std::uint64_t> stalled_writes_{0};
+    std::atomic<std::uint64_t> stall_ns_{0};
+    std::atomic<std::uint64_t> stall_timeouts_{0};
+
+    /// Delay owed by the throttled writes of the calling thread that it has not slept off yet.
+    static inline thread_local std::chrono::nanoseconds throttle_debt_{0};
+    /// Budget whose next AdmitWrite on the calling thread was admitted ahead by AdmitWriteAhead.
+    static inline thread_local const MemoryBudget* admitted_ahead_ = nullptr;
+};
+
+inline void MemoryBudget::Reserve(std::uint64_t bytes, Usage usage)
+{
+    if (usage == Usage::kRun)
+    {
+        run_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+        return;
+    }
+    const auto used = used_.fetch_add(bytes) + bytes;
+    auto peak = peak_.load(std::memory_order_relaxed);
+    while (used > peak && !peak_.compare_exchange_weak(peak, used, std::memory_order_relaxed)) {}
+}
+
+inline void MemoryBudget::Release(std::uint64_t bytes, Usage usage)
+{
+    if (usage == Usage::kRun)
+    {
+        run_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+        return;
+    }
+    used_.fetch_sub(bytes);
+    // A waiter registers before checking the usage, so either it sees the release or the release
+    // sees it.
+    if (waiters_.load() > 0)
+    {
+        std::lock_guard lock(mutex_);
+        released_.notify_all();
+    }
+}
+
+inline std::chrono::nanoseconds MemoryBudget::WriteDelay() const
+{
+    const auto used = Used();
+    if (used <= slowdown_threshold_ || used >= limit_)
+    {
+        return std::chrono::nanoseconds(0);
+    }
+    const auto pressure = static_cast<double>(used - slowdown_threshold_) /
+                          static_cast<double>(limit_ - slowdown_threshold_);
+    return std::chrono::nanoseconds(
+        static_cast<std::int64_t>(pressure * static_cast<double>(options_.max_delay.count())));
+}
+
+inline void MemoryBudget::Delay()
+{
+    const auto delay = WriteDelay();
+    if (delay.count() == 0)
+    {
+        return;
+    }
+    throttled_writes_.fetch_add(1, std::memory_order_relaxed);
+    throttle_debt_ += delay;
+    if (throttle_debt_ < options_.sleep_quantum)
+    {
+        return;
+    }
+    const auto start = Clock::now();
+    std::this_thread::sleep_for(std::exchange(throttle_debt_, std::chrono::nanoseconds(0)));
+    throttle_ns_.fetch_add(Nanoseconds(Clock::now() - start), std::memory_order_relaxed);
+}
+
+template <typename TRelieve>
+void MemoryBudget::AdmitWrite(TRelieve&& relieve)
+{
+    if (std::exchange(admitted_ahead_, nullptr) == this)
+    {
+        return;
+    }
+    Delay();
+    if (!Exhausted())
+    {
+        return;
+    }
+
+    stalled_writes_.fetch_add(1, std::memory_order_relaxed);
+    const auto start = Clock::now();
+    relieve();
+    if (Exhausted())
+    {
+        std::unique_lock lock(mutex_);
+        ++waiters_;
+        if (!released_.wait_for(lock, options_.max_stall, [this] { return !Exhausted(); }))
+        {
+            stall_timeouts_.fetch_add(1, std::memory_order_relaxed);
+        }
+        --waiters_;
+    }
+    stall_ns_.fetch_add(Nanoseconds(Clock::now() - start), std::memory_order_relaxed);
+}
+
+template <typename TRelieve>
+void MemoryBudget::AdmitWriteAhead(TRelieve&& relieve)
+{
+    AdmitWrite(std::forward<TRelieve>(relieve));
+    admitted_ahead_ = this;
+}
+
+inline MemoryBudgetStats MemoryBudget::Stats() const
+{
+    MemoryBudgetStats stats;
+    stats.limit = limit_;
+    stats.used = Used();
+    stats.peak = peak_.load(std::memory_order_relaxed);
+    stats.run_bytes = RunBytes();
+    stats.throttled_writes = throttled_writes_.load(std::memory_order_relaxed);
+    stats.throttle_ns = throttle_ns_.load(std::memory_order_relaxed);
+    stats.stalled_writes = stalled_writes_.load(std::memory_order_relaxed);
+    stats.stall_ns = stall_ns_.load(std::memory_order_relaxed);
+    stats.stall_timeouts = stall_timeouts_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+inline std::string ToJson(const MemoryBudgetStats& stats)
+{
+    return JsonObject()
+        .Add("limit", stats.limit)
+        .Add("used", stats.used)
+        .Add("peak", stats.peak)
+        .Add("run_bytes", stats.run_bytes)
+        .Add("throttled_writes", stats.throttled_writes)
+        .Add("throttle_ns", stats.throttle_ns)
+        .Add("stalled_writes", stats.stalled_writes)
+        .Add("stall_ns", stats.stall_ns)
+        .Add("stall_timeouts", stats.stall_timeouts)
+        .Str();
+}
+
+/**
+ * Bytes reserved from a MemoryBudget, released when the reservation is destroyed. Without a
+ * budget, it only keeps count of the bytes.
+ */
+class MemoryReservation
+{
+public:
+    MemoryReservation() = default;
+
+    explicit MemoryReservation(std::shared_ptr<MemoryBudget> budget,
+                               MemoryBudget::Usage usage = MemoryBudget::Usage::kMemtable)
+        : budget_(std::move(budget)), usage_(usage)
+    {}
+
+    MemoryReservation(MemoryReservation&& other) noexcept
+        : budget_(std::move(other.budget_)),
+          usage_(other.usage_),
+          bytes_(std::exchange(other.bytes_, 0))
+    {}
+
+    MemoryReservation& operator=(MemoryReservation&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Resize(0);
+            budget_ = std::move(other.budget_);
+            usage_ = other.usage_;
+            bytes_ = std::exchange(other.bytes_, 0);
+        }
+        return *this;
+    }
+
+    ~MemoryReservation()
+    {
+        Resize(0);
+    }
+
+    /**
+     * Reserves or releases the difference between bytes and the bytes reserved so far.
+     */
+    void Resize(std::uint64_t bytes)
+    {
+        if (budget_ && bytes > bytes_)
+        {
+            budget_->Reserve(bytes - bytes_, usage_);
+        }
+        else if (budget_ && bytes < bytes_)
+        {
+            budget_->Release(bytes_ - bytes, usage_);
+        }
+        bytes_ = bytes;
+    }
+
+    std::uint64_t Bytes() const
+    {
+        return bytes_;
+    }
+
+    MemoryBudget* Budget() const
+    {
+        return budget_.get();
+    }
+
+private:
+    std::shared_ptr<MemoryBudget> budget_;
+    MemoryBudget::Usage usage_ = MemoryBudget::Usage::kMemtable;
+    std::uint64_t bytes_ = 0;
+};
+
+#endif  // DATA_STRUCTURES_MEMORY_BUDGET_HPP
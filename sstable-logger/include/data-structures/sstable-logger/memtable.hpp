@@ -0,0 +1,154 @@
+#ifndef DATA_STRUCTURES_MEMTABLE_HPP
+#define DATA_STRUCTURES_MEMTABLE_HPP
+
+#include <data-structures/binary-search-tree/bst_finger.hpp>
+#include <data-structures/binary-search-tree/bst_node.hpp>
+#include <data-structures/binary-search-tree/bt_update_strategies.hpp>
+#include <data-structures/radix-tree/adaptive_radix_tree.hpp>
+
+#include <cstddef>
+#include <utility>
+
+/*
+ * Memtable backends of BasicSSTableLogger. A memtable is an ordered map with unique keys that
+ * provides:
+ *  - bool Empty() const
+ *  - const TValue& Insert(TKey key, TValue value), for a key that is not in the memtable yet,
+ *    returning the inserted value, which stays in place until Clear()
+ *  - bool ForEach(visit) const, which calls visit(key, value) for every entry in key order, until
+ *    visit returns false
+ *  - bool ForEachFrom(key, visit) const, which does the same starting from the first entry with a
+ *    key not less than key
+ *  - std::size_t MemoryBytes() const, bytes of the nodes of the memtable, including the keys and
+ *    values stored in them, but not memory the keys and values own on the heap
+ *  - void Clear()
+ */
+
+/**
+ * Memtable backed by a binary search tree, into which entries are inserted through a finger to the
+ * last inserted node. Keys only need to be totally ordered.
+ */
+template <typename TKey, typename TValue>
+class BSTMemtable
+{
+public:
+    bool Empty() const
+    {
+        return !root_;
+    }
+
+    const TValue& Insert(TKey key, TValue value)
+    {
+        if (!root_)
+        {
+            root_ = MakeBSTNode<UpdateStrategy>(std::move(key), std::move(value));
+            finger_.Reset(root_);
+            node_count_ = 1;
+            return root_->Value();
+        }
+
+        // Keys logged in increasing or nearly increasing order, such as timestamps, are inserted
+        // close to the previous one, so the finger spares the descent from the root. Such keys
+        // would also build a chain of right children, which rebalancing keeps logarithmic for
+        // the lookups from the root. Rebalancing only relinks nodes, so values stay in their nodes.
+        const auto inserted = finger_.Insert(std::move(key), std::move(value)).first;
+        ++node_count_;
+        root_ = finger_.Rebalance(node_count_);
+        return inserted->Value();
+    }
+
+    template <typename TVisitor>
+    bool ForEach(TVisitor&& visit) const
+    {
+        return !root_ || VisitRange(root_->Begin(), visit);
+    }
+
+    template <typename TVisitor>
+    bool ForEachFrom(const TKey& key, TVisitor&& visit) const
+    {
+        return !root_ || VisitRange(root_->LowerBound(key), visit);
+    }
+
+    std::size_t MemoryBytes() const
+    {
+        return node_count_ * kNodeBytes;
+    }
+
+    void Clear()
+    {
+        root_.reset();
+        finger_.Reset(nullptr);
+        node_count_ = 0;
+    }
+
+private:
+    using UpdateStrategy = RejectUpdates<TKey, TValue>;
+    using Node = BSTNode<TKey, TValue, UpdateStrategy>;
+
+    /// Nodes are allocated by std::make_shared together with a control block of a vtable pointer
+    /// and two reference counts.
+    static constexpr std::size_t kNodeBytes = sizeof(Node) + 2 * sizeof(void*);
+
+    template <typename TVisitor>
+    bool VisitRange(typename Node::ConstIterator it, TVisitor& visit) const
+    {
+        for (; it != root_->End(); ++it)
+        {
+            if (!visit((*it).Key(), (*it).Value()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    typename Node::NodePtr root_;
+    BSTFinger<Node> finger_{nullptr};
+    std::size_t node_count_ = 0;
+};
+
+/**
+ * Memtable backed by an adaptive radix tree. Keys need a binary-comparable encoding, see
+ * RadixKey.
+ */
+template <typename TKey, typename TValue>
+class ARTMemtable
+{
+public:
+    bool Empty() const
+    {
+        return tree_.Empty();
+    }
+
+    const TValue& Insert(TKey key, TValue value)
+    {
+        return *tree_.Insert(std::move(key), std::move(value)).first;
+    }
+
+    std::size_t MemoryBytes() const
+    {
+        return tree_.MemoryBytes();
+    }
+
+    template <typename TVisitor>
+    bool ForEach(TVisitor&& visit) const
+    {
+        return tree_.ForEach(visit);
+    }
+
+    template <typename TVisitor>
+    bool ForEachFrom(const TKey& key, TVisitor&& visit) const
+    {
+        return tree_.ForEachFrom(key, visit);
+    }
+
+    void Clear()
+    {
+        tree_.Clear();
+    }
+
+private:
+    AdaptiveRadixTree<TKey, TValue> tree_;
+};
+
+#endif  // DATA_STRUCTURES_MEMTABLE_HPP
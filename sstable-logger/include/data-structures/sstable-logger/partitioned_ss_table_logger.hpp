@@ -0,0 +1,212 @@
+#ifndef DATA_STRUCTURES_PARTITIONED_SS_TABLE_LOGGER_HPP
+#define DATA_STRUCTURES_PARTITIONED_SS_TABLE_LOGGER_HPP
+
+#include "ss_table_logger.hpp"
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <utility>
+
+/**
+ * SSTableLogger partitioned by key into consecutive windows of equal width, such as one hour of
+ * timestamps each. Every window has its own logger, with its own memtable and runs.
+ *
+ * Writes and lookups go straight to the window of their key, scans visit only the windows that
+ * overlap the scanned range, and retention drops the oldest windows whole, without any work per
+ * key. Only the windows that were written to exist, so keys may be spread arbitrarily far apart.
+ *
+ * @tparam TLogger logger of a window, an instantiation of BasicSSTableLogger with integral keys
+ */
+template <typename TLogger>
+class PartitionedSSTableLogger
+{
+public:
+    using LoggerType = TLogger;
+    using KeyType = typename TLogger::KeyType;
+    using EntryType = typename TLogger::EntryType;
+    using Options = typename TLogger::Options;
+
+    static_assert(std::integral<KeyType>, "PartitionedSSTableLogger needs integral keys");
+
+    /**
+     * @param window_width Width of the key range of a window.
+     * @param options Options of the logger of every window.
+     */
+    explicit PartitionedSSTableLogger(KeyType window_width, Options options = {})
+        : window_width_(window_width), options_(std::move(options))
+    {
+        assert(window_width_ > 0 && "Windows must not be empty");
+    }
+
+    /**
+     * Logs an entry into the window of key. See BasicSSTableLogger::Log.
+     */
+    template <typename... Args>
+    void Log(KeyType key, Args&&... args)
+    {
+        WindowOf(key).Log(key, std::forward<Args>(args)...);
+    }
+
+    /**
+     * Erases the entry logged under key. See BasicSSTableLogger::Erase.
+     */
+    void Erase(KeyType key)
+    {
+        WindowOf(key).Erase(key);
+    }
+
+    /**
+     * Merges an entry into the one logged under key. See BasicSSTableLogger::Merge.
+     */
+    template <typename... Args>
+    void Merge(KeyType key, Args&&... args)
+    {
+        WindowOf(key).Merge(key, std::forward<Args>(args)...);
+    }
+
+    /**
+     * Retrieves the latest entry logged under key, looking only into the window of key.
+     */
+    std::optional<EntryType> Retrieve(KeyType key);
+
+    /**
+     * Visits the latest entries with keys in [lo, hi), in key order, skipping the windows outside
+     * of the range. See BasicSSTableLogger::Scan.
+     */
+    template <typename TVisitor>
+    bool Scan(KeyType lo, KeyType hi, TVisitor&& visit);
+
+    /**
+     * Flushes the memtables of all windows.
+     */
+    void Flush();
+
+    /**
+     * Compacts the runs of all windows.
+     */
+    void Compact();
+
+    /**
+     * Drops every window whose keys are all less than key, together with all entries logged into
+     * it. Apart from releasing the memory of a window, this takes constant time per window,
+     * regardless of the number of entries in it.
+     * @return Number of non-empty windows dropped.
+     */
+    std::size_t DropWindowsBefore(KeyType key);
+
+    /**
+     * @return Number of windows that were written to and not dropped yet.
+     */
+    std::size_t WindowCount() const
+    {
+        return windows_.size();
+    }
+
+    /**
+     * @return Smallest key of the oldest window, or nullopt if there are no windows.
+     */
+    std::optional<KeyType> OldestWindowStart() const
+    {
+        if (windows_.empty())
+        {
+            return std::nullopt;
+        }
+        return windows_.begin()->first * window_width_;
+    }
+
+private:
+    /**
+     * @return Index of the window of key, rounding towards negative infinity.
+     */
+    KeyType WindowIndex(KeyType key) const
+    {
+        const auto index = key / window_width_;
+        return key % window_width_ < 0 ? index - 1 : index;
+    }
+
+    /**
+     * @return Logger of the window of key, which is created if needed.
+     */
+    TLogger& WindowOf(KeyType key);
+
+    /**
+     * @return Logger of the window of key, or nullptr if it does not exist.
+     */
+    TLogger* FindWindow(KeyType key);
+
+    KeyType window_width_;
+    Options options_;
+
+    /// Loggers of the windows that were written to, by window index.
+    std::map<KeyType, TLogger> windows_;
+};
+
+template <typename TLogger>
+std::optional<typename PartitionedSSTableLogger<TLogger>::EntryType>
+PartitionedSSTableLogger<TLogger>::Retrieve(KeyType key)
+{
+    const auto window = FindWindow(key);
+    return window ? window->Retrieve(key) : std::nullopt;
+}
+
+template <typename TLogger>
+template <typename TVisitor>
+bool PartitionedSSTableLogger<TLogger>::Scan(KeyType lo, KeyType hi, TVisitor&& visit)
+{
+    if (windows_.empty() || !(lo < hi))
+    {
+        return true;
+    }
+
+    const auto last = WindowIndex(hi - 1);
+    for (auto it = windows_.lower_bound(WindowIndex(lo)); it != windows_.end() && it->first <= last;
+         ++it)
+    {
+        if (!it->second.Scan(lo, hi, visit))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename TLogger>
+void PartitionedSSTableLogger<TLogger>::Flush()
+{
+    for (auto& [index, window] : windows_) { window.Flush(); }
+}
+
+template <typename TLogger>
+void PartitionedSSTableLogger<TLogger>::Compact()
+{
+    for (auto& [index, window] : windows_) { window.Compact(); }
+}
+
+template <typename TLogger>
+std::size_t PartitionedSSTableLogger<TLogger>::DropWindowsBefore(KeyType key)
+{
+    // The window of key itself is kept, and so are the windows after it.
+    const auto end = windows_.lower_bound(WindowIndex(key));
+    const auto dropped = static_cast<std::size_t>(std::distance(windows_.begin(), end));
+    windows_.erase(windows_.begin(), end);
+    return dropped;
+}
+
+template <typename TLogger>
+TLogger& PartitionedSSTableLogger<TLogger>::WindowOf(KeyType key)
+{
+    return windows_.try_emplace(WindowIndex(key), options_).first->second;
+}
+
+template <typename TLogger>
+TLogger* PartitionedSSTableLogger<TLogger>::FindWindow(KeyType key)
+{
+    const auto it = windows_.find(WindowIndex(key));
+    return it == windows_.end() ? nullptr : &it->second;
+}
+
+#endif  // DATA_STRUCTURES_PARTITIONED_SS_TABLE_LOGGER_HPP
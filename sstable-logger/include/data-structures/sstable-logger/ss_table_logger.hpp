@@ -5,23 +5,185 @@
 #ifndef DATA_STRUCTURES_SS_TABLE_LOGGER_HPP
 #define DATA_STRUCTURES_SS_TABLE_LOGGER_HPP
 
-#include <data-structures/binary-search-tree/bst_node.hpp>
-#include <data-structures/binary-search-tree/bt_update_strategies.hpp>
+#include <data-structures/hash-table/swiss_table.hpp>
+#include <data-structures/instrumentation/memory_usage.hpp>
+#include <data-structures/radix-tree/radix_key.hpp>
 
+#include "memory_budget.hpp"
+#include "memtable.hpp"
+#include "ss_table_logger_stats.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <compare>
+#include <concepts>
 #include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
 
 /**
  * Logger class that writes log entries in an arbitrary order and reads them sorted by key.
  *
+ * Entries are first logged to an in-memory memtable. Flush() freezes the memtable into an immutable
+ * sorted run, and Compact() merges all runs into one. Every logged entry is stamped with a
+ * monotonically increasing sequence number, and newer entries shadow older ones with the same key,
+ * across the memtable and all runs. Older versions are kept for as long as a snapshot can see them.
+ *
+ * Merge() combines an entry with the one already logged under the same key through a user-supplied
+ * merge operator, either immediately or lazily, by logging a merge operand that is combined with
+ * the older versions when the entry is retrieved, flushed or compacted.
+ *
+ * The logger does no synchronization of its own. Calls from different threads must be serialized
+ * by the caller, and that includes reads at a snapshot, which see a fixed point in the history of
+ * the logger but still read the same memtable and runs that writes, flushes and compactions
+ * modify. Concurrent Retrieve calls are safe with each other. AsyncSSTableLogger wraps a logger
+ * with a reader-writer lock for callers that read and write from several threads.
+ *
+ * @tparam TKey key type
+ * @tparam TMemtable memtable backend, see memtable.hpp. BSTMemtable only needs totally ordered
+ * keys, while ARTMemtable needs keys with a RadixKey encoding, such as integers and strings.
  * @tparam Args parameter type pack that determines the type of an entry.
  */
-template <typename... Args>
-class SSTableLogger
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+class BasicSSTableLogger
 {
+    enum class RecordType : std::uint8_t
+    {
+        kValue,
+        kTombstone,
+        kMergeOperand
+    };
+
 public:
-    using KeyType = std::int64_t;
+    using KeyType = TKey;
+    using EntryType = std::tuple<Args...>;
+    using SequenceNumber = std::uint64_t;
+    using Clock = std::chrono::steady_clock;
+    /// Merges the second entry into the first. Must be associative.
+    using MergeOperator = std::function<void(EntryType&, EntryType&&)>;
+
+    enum class MergeMode : bool
+    {
+        /// Merge() reads the latest entry, merges into it and logs the result.
+        kEager,
+        /// Merge() logs a merge operand, which is merged on Retrieve, Flush and Compact.
+        kLazy
+    };
+
+    struct Options
+    {
+        /// Entries logged longer than ttl ago are not retrieved and are dropped on Flush and
+        /// Compact. Only the newest version of a key is checked, so a merge operand renews the
+        /// entry it merges into, as an eager merge does. Entries never expire if not set.
+        std::optional<Clock::duration> ttl;
+        /// Source of the current time.
+        std::function<Clock::time_point()> clock = &Clock::now;
+        /// Operator used by Merge().
+        MergeOperator merge_operator;
+        MergeMode merge_mode = MergeMode::kEager;
+        /// Budget the memtable reserves its bytes from and the runs report theirs to, possibly
+        /// shared with other loggers. Writes are throttled and stalled as the budget runs out, see
+        /// MemoryBudget. Unlimited if not set.
+        std::shared_ptr<MemoryBudget> memory_budget;
+        /// Keeps a hash index from every key in the memtable to its newest version, so that
+        /// Retrieve skips the memtable search for keys that are not in it, and reads the newest
+        /// version directly when it resolves the key. Costs a hash table insert per write, and
+        /// memory counted in MemtableBytes. Requires keys that are Hashable, the constructor
+        /// throws std::invalid_argument otherwise.
+        bool point_lookup_index = false;
+    };
+
+    /**
+     * Point in the history of the logger. Reads at a snapshot see exactly the entries that had been
+     * logged when the snapshot was taken.
+     * @note A snapshot does not make reads safe to run concurrently with writes, see the class
+     * documentation.
+     */
+    class Snapshot
+    {
+    public:
+        SequenceNumber Sequence() const
+        {
+            return sequence_;
+        }
+
+    private:
+        explicit Snapshot(SequenceNumber sequence) : sequence_(sequence) {}
+
+        friend BasicSSTableLogger;
+
+        SequenceNumber sequence_;
+    };
+
+    /**
+     * Group of writes that become visible to readers all at once.
+     */
+    class WriteBatch
+    {
+    public:
+        void Log(KeyType key, Args... args)
+        {
+            writes_.push_back(
+                {std::move(key), RecordType::kValue, std::make_tuple(std::move(args)...)});
+        }
+
+        void Erase(KeyType key)
+        {
+            writes_.push_back({std::move(key), RecordType::kTombstone, std::nullopt});
+        }
+
+        void Merge(KeyType key, Args... args)
+        {
+            writes_.push_back(
+                {std::move(key), RecordType::kMergeOperand, std::make_tuple(std::move(args)...)});
+        }
+
+    private:
+        friend BasicSSTableLogger;
+
+        struct Write
+        {
+            KeyType key;
+            RecordType type;
+            std::optional<EntryType> entry;
+        };
+
+        std::vector<Write> writes_;
+    };
+
+    BasicSSTableLogger() = default;
+
+    /**
+     * @throws std::invalid_argument if Options::point_lookup_index is set for keys that are not
+     * Hashable.
+     */
+    explicit BasicSSTableLogger(Options options)
+        : options_(std::move(options)),
+          memtable_memory_(options_.memory_budget),
+          run_memory_(options_.memory_budget, MemoryBudget::Usage::kRun)
+    {
+        if constexpr (!Hashable<KeyType>)
+        {
+            if (options_.point_lookup_index)
+            {
+                throw std::invalid_argument("The point lookup index requires hashable keys");
+            }
+        }
+    }
 
     /**
      * Logs an entry consisting of values contained in the args pack under key.
@@ -30,44 +192,686 @@ public:
      */
     void Log(KeyType key, Args... args);
 
+    /**
+     * Erases the entry logged under key by logging a tombstone that shadows all older entries.
+     * @param key Key of the entry to erase.
+     */
+    void Erase(KeyType key);
+
+    /**
+     * Merges the entry consisting of values contained in the args pack into the entry logged under
+     * key, using Options::merge_operator. If there is no entry under key, logs the args as is.
+     * @param key Key of the entry to merge into.
+     * @param args Arguments for the entry to merge.
+     */
+    void Merge(KeyType key, Args... args);
+
+    /**
+     * Applies all writes in the batch under consecutive sequence numbers.
+     * @param batch Writes to apply.
+     */
+    void Write(WriteBatch batch);
+
     /**
      * Retrieves the latest entry logged under key, if any.
      * @param key Key under which to search for the entry
-     * @return A tuple of values corresponding to the requested entry, or nullopt if not found.
+     * @return A tuple of values corresponding to the requested entry, or nullopt if not found,
+     * erased or expired.
+     */
+    std::optional<EntryType> Retrieve(KeyType key);
+
+    /**
+     * Retrieves the latest entry logged under key at the time the snapshot was taken, if any.
+     * @param key Key under which to search for the entry
+     * @param snapshot Snapshot to read from.
+     * @return A tuple of values corresponding to the requested entry, or nullopt if not found,
+     * erased or expired.
+     */
+    std::optional<EntryType> Retrieve(KeyType key, const Snapshot& snapshot);
+
+    /**
+     * Visits the latest entries with keys in [lo, hi), in key order.
+     * @param visit Called as visit(key, entry) for every entry, until it returns false.
+     * @return Whether all entries in the range were visited.
+     */
+    template <typename TVisitor>
+    bool Scan(const KeyType& lo, const KeyType& hi, TVisitor&& visit);
+
+    /**
+     * Takes a snapshot of the current state of the logger. The versions visible to the snapshot
+     * are retained by Flush and Compact until the snapshot is released.
+     */
+    Snapshot GetSnapshot();
+
+    /**
+     * Releases a snapshot previously returned by GetSnapshot.
+     */
+    void ReleaseSnapshot(const Snapshot& snapshot);
+
+    /**
+     * Freezes the memtable into a new immutable sorted run, dropping expired entries and versions
+     * that are not visible to any snapshot. Tombstones are kept, since they may shadow entries in
+     * older runs.
+     */
+    void Flush();
+
+    /**
+     * Merges all runs into a single run, dropping expired entries, versions that are not visible
+     * to any snapshot and tombstones that no longer shadow anything.
+     * @note Does not flush the memtable.
      */
-    std::optional<std::tuple<Args...>> Retrieve(KeyType key);
+    void Compact();
+
+    /**
+     * @return Bytes of the memtable: its nodes, including the keys and records stored in them,
+     * the memory the keys and entries own on the heap, see HeapBytes, and the point lookup index.
+     */
+    std::uint64_t MemtableBytes() const
+    {
+        return memtable_memory_.Bytes();
+    }
+
+    /**
+     * @return Bytes of the runs: their records, and the memory the keys and entries in them own on
+     * the heap.
+     */
+    std::uint64_t RunBytes() const
+    {
+        return run_memory_.Bytes();
+    }
+
+    /**
+     * @return Statistics of this logger. The run counts and the memtable bytes are always
+     * available, everything else is only collected when kStatsEnabled is true, and zero otherwise.
+     */
+    SSTableLoggerStats Stats() const;
 
 private:
-    using MemtableNode =
-        BSTNode<KeyType, std::tuple<Args...>, AcceptUpdates<KeyType, std::tuple<Args...>>>;
-    typename MemtableNode::NodePtr memtable_;
+    struct InternalKey
+    {
+        KeyType key;
+        SequenceNumber sequence;
+
+        friend bool operator==(const InternalKey&, const InternalKey&) = default;
+
+        /// Orders by key, and versions of the same key from the newest to the oldest.
+        friend auto operator<=>(const InternalKey& lhs, const InternalKey& rhs)
+            -> std::compare_three_way_result_t<KeyType>
+        {
+            if (const auto by_key = lhs.key <=> rhs.key; by_key != 0)
+            {
+                return by_key;
+            }
+            return rhs.sequence <=> lhs.sequence;
+        }
+
+        /// The sequence number is encoded inverted, so that newer versions precede older ones.
+        void AppendRadixKey(std::string& out) const
+        {
+            RadixKey<KeyType>::Append(out, key);
+            RadixKey<SequenceNumber>::Append(out, ~sequence);
+        }
+    };
+
+    struct Record
+    {
+        RecordType type;
+        /// Logged entry or merge operand, or nullopt for a tombstone.
+        std::optional<EntryType> entry;
+        Clock::time_point logged_at;
+    };
+
+    using Run = std::vector<std::pair<InternalKey, Record>>;
+
+    /// Newest version of a key in the memtable, as kept by the point lookup index.
+    struct IndexEntry
+    {
+        SequenceNumber sequence;
+        const Record* record;
+    };
+
+    /**
+     * Throttles or stalls a write when the memory budget runs low, flushing the memtable if the
+     * budget is exhausted.
+     */
+    void AdmitWrite();
+
+    static std::uint64_t BytesOf(const Run& run);
+
+    void Append(KeyType key,
+                RecordType type,
+                std::optional<EntryType> entry,
+                Clock::time_point now);
+
+    /**
+     * @return Whether the memtable may hold versions of key, which is always the case without the
+     * point lookup index, and the newest of them if the index has it.
+     */
+    std::pair<bool, const IndexEntry*> FindIndexed(const KeyType& key) const;
+
+    std::uint64_t PointIndexBytes() const
+    {
+        if constexpr (Hashable<KeyType>)
+        {
+            return point_index_.MemoryBytes();
+        }
+        return 0;
+    }
+
+    /**
+     * Merges the entries in operands, ordered from the newest to the oldest, into base.
+     */
+    std::optional<EntryType> ApplyOperands(std::optional<EntryType> base,
+                                           std::vector<EntryType> operands) const;
+
+    bool IsExpired(const Record& record, Clock::time_point now) const;
+
+    /**
+     * Drops the versions in a sorted run that no reader can observe any more.
+     *
+     * @param run Run sorted by internal key.
+     * @param bottommost Whether no older runs remain that the versions in run could shadow.
+     */
+    Run Collapse(Run run, bool bottommost) const;
+
+    /**
+     * Merges an older version of the same key into a merge operand.
+     */
+    void MergeInto(Record& operand, Record&& older) const;
+
+    Options options_;
+
+    SequenceNumber last_sequence_ = 0;
+    std::multiset<SequenceNumber> snapshots_;
+
+    TMemtable<InternalKey, Record> memtable_;
+    /// Heap memory owned by the keys and entries in the memtable and the point lookup index.
+    std::uint64_t memtable_heap_bytes_ = 0;
+    /// Point lookup index, empty unless Options::point_lookup_index is set. Not instantiated for
+    /// keys that are not Hashable.
+    [[no_unique_address]] std::conditional_t<Hashable<KeyType>,
+                                             SwissTable<KeyType, IndexEntry>,
+                                             std::monostate> point_index_;
+    MemoryReservation memtable_memory_;
+    /// Immutable sorted runs, oldest first.
+    std::vector<Run> runs_;
+    MemoryReservation run_memory_;
+
+    [[no_unique_address]] SSTableLoggerCounters<> stats_;
 };
 
+/**
+ * SSTableLogger with 64-bit integer keys, such as timestamps, and a binary search tree memtable.
+ */
 template <typename... Args>
-void SSTableLogger<Args...>::Log(SSTableLogger::KeyType key, Args... args)
+using SSTableLogger = BasicSSTableLogger<std::int64_t, BSTMemtable, Args...>;
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+void BasicSSTableLogger<TKey, TMemtable, Args...>::Log(KeyType key, Args... args)
+{
+    AdmitWrite();
+    Append(key, RecordType::kValue, std::make_tuple(std::move(args)...), options_.clock());
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+void BasicSSTableLogger<TKey, TMemtable, Args...>::Erase(KeyType key)
+{
+    AdmitWrite();
+    Append(key, RecordType::kTombstone, std::nullopt, options_.clock());
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+void BasicSSTableLogger<TKey, TMemtable, Args...>::Merge(KeyType key, Args... args)
 {
-    if (!memtable_)
+    AdmitWrite();
+    Append(key, RecordType::kMergeOperand, std::make_tuple(std::move(args)...), options_.clock());
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+void BasicSSTableLogger<TKey, TMemtable, Args...>::Write(WriteBatch batch)
+{
+    // The batch is admitted as a whole, so that a flush never separates its writes.
+    AdmitWrite();
+    const auto now = options_.clock();
+    for (auto& write : batch.writes_)
+    { Append(std::move(write.key), write.type, std::move(write.entry), now); }
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+void BasicSSTableLogger<TKey, TMemtable, Args...>::Append(KeyType key,
+                                                   RecordType type,
+                                                   std::optional<EntryType> entry,
+                                                   Clock::time_point now)
+{
+    ScopedOperation<> operation(stats_.append);
+    if (type == RecordType::kMergeOperand)
     {
-        memtable_ = MakeBSTNode<AcceptUpdates<KeyType, std::tuple<Args...>>>(
-            key, std::make_tuple(std::move(args)...));
+        assert(options_.merge_operator && "Merge requires a merge operator");
+        if (options_.merge_mode == MergeMode::kEager)
+        {
+            entry = ApplyOperands(Retrieve(key), {std::move(*entry)});
+            type = RecordType::kValue;
+        }
     }
+
+    stats_.Logged(type == RecordType::kValue       ? &SSTableLoggerStats::values_logged
+                  : type == RecordType::kTombstone ? &SSTableLoggerStats::tombstones_logged
+                                                   : &SSTableLoggerStats::merge_operands_logged);
+
+    memtable_heap_bytes_ += HeapBytes(key) + HeapBytes(entry);
+    IndexEntry* indexed = nullptr;
+    if constexpr (Hashable<KeyType>)
+    {
+        if (options_.point_lookup_index)
+        {
+            const auto indexed_keys = point_index_.Size();
+            indexed = &point_index_.InsertOrAssign(key, IndexEntry{});
+            if (point_index_.Size() > indexed_keys)
+            {
+                memtable_heap_bytes_ += HeapBytes(key);
+            }
+        }
+    }
+
+    const auto sequence = ++last_sequence_;
+    const auto& record = memtable_.Insert(InternalKey{std::move(key), sequence},
+                                          Record{type, std::move(entry), now});
+    if (indexed)
+    {
+        *indexed = {sequence, &record};
+    }
+    memtable_memory_.Resize(memtable_.MemoryBytes() + PointIndexBytes() + memtable_heap_bytes_);
 }
 
-template <typename... Args>
-std::optional<std::tuple<Args...>> SSTableLogger<Args...>::Retrieve(SSTableLogger::KeyType key)
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+std::pair<bool,
+          const typename BasicSSTableLogger<TKey, TMemtable, Args...>::IndexEntry*>
+BasicSSTableLogger<TKey, TMemtable, Args...>::FindIndexed(const KeyType& key) const
+{
+    if constexpr (Hashable<KeyType>)
+    {
+        if (options_.point_lookup_index)
+        {
+            const auto indexed = point_index_.Find(key);
+            return {indexed != nullptr, indexed};
+        }
+    }
+    return {true, nullptr};
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+void BasicSSTableLogger<TKey, TMemtable, Args...>::AdmitWrite()
 {
-    if (!memtable_)
+    if (const auto budget = memtable_memory_.Budget())
     {
-        return {};
+        budget->AdmitWrite([this] { Flush(); });
     }
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+std::uint64_t BasicSSTableLogger<TKey, TMemtable, Args...>::BytesOf(const Run& run)
+{
+    std::uint64_t bytes = run.capacity() * sizeof(typename Run::value_type);
+    for (const auto& [key, record] : run) { bytes += HeapBytes(key.key) + HeapBytes(record.entry); }
+    return bytes;
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+std::optional<typename BasicSSTableLogger<TKey, TMemtable, Args...>::EntryType>
+BasicSSTableLogger<TKey, TMemtable, Args...>::Retrieve(KeyType key)
+{
+    return Retrieve(key, Snapshot(last_sequence_));
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+std::optional<typename BasicSSTableLogger<TKey, TMemtable, Args...>::EntryType>
+BasicSSTableLogger<TKey, TMemtable, Args...>::Retrieve(KeyType key,
+                                                   const Snapshot& snapshot)
+{
+    ScopedOperation<> operation(stats_.retrieve);
+    const auto now = options_.clock();
+    const InternalKey internal_key{key, snapshot.Sequence()};
+
+    // Versions are visited from the newest to the oldest, collecting merge operands until one
+    // that does not depend on older versions is found. Only the newest version decides whether
+    // the key has expired.
+    std::vector<EntryType> operands;
+    std::optional<EntryType> base;
+    auto newest = true;
+    const auto visit = [&](const Record& record) {
+        operation.Compare();
+        if (std::exchange(newest, false) && IsExpired(record, now))
+        {
+            return false;
+        }
+        switch (record.type)
+        {
+            case RecordType::kMergeOperand:
+                operands.push_back(*record.entry);
+                return true;
+            case RecordType::kValue:
+                base = record.entry;
+                return false;
+            case RecordType::kTombstone:
+                return false;
+        }
+        return false;
+    };
 
-    auto node_ptr = memtable_->Find(key);
-    if (!node_ptr)
+    auto visit_more = true;
+    const auto [in_memtable, indexed] = FindIndexed(key);
+    if (indexed && indexed->sequence <= snapshot.Sequence()
+        && indexed->record->type != RecordType::kMergeOperand)
     {
-        return {};
+        // The newest version resolves the key on its own, so the memtable is not searched.
+        visit_more = visit(*indexed->record);
+    }
+    else if (in_memtable)
+    {
+        memtable_.ForEachFrom(internal_key, [&](const InternalKey& version, const Record& record) {
+            if (!(version.key == key))
+            {
+                return false;
+            }
+            visit_more = visit(record);
+            return visit_more;
+        });
     }
 
-    return node_ptr->Value();
+    const auto resolved_in_memtable = !visit_more;
+    std::uint64_t searched_runs = 0;
+    for (auto run = runs_.rbegin(); visit_more && run != runs_.rend(); ++run)
+    {
+        ++searched_runs;
+        for (auto found = std::lower_bound(run->begin(),
+                                           run->end(),
+                                           internal_key,
+                                           [](const auto& item, auto k) { return item.first < k; });
+             visit_more && found != run->end() && found->first.key == key;
+             ++found)
+        { visit_more = visit(found->second); }
+    }
+
+    stats_.Retrieved(resolved_in_memtable ? &SSTableLoggerStats::retrieves_resolved_in_memtable
+                     : visit_more         ? &SSTableLoggerStats::retrieves_searched_everything
+                                          : &SSTableLoggerStats::retrieves_resolved_in_runs,
+                     searched_runs);
+
+    return ApplyOperands(std::move(base), std::move(operands));
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+template <typename TVisitor>
+bool BasicSSTableLogger<TKey, TMemtable, Args...>::Scan(const KeyType& lo,
+                                                    const KeyType& hi,
+                                                    TVisitor&& visit)
+{
+    // The newest possible version of lo precedes all versions of all keys not less than lo.
+    const InternalKey first{lo, std::numeric_limits<SequenceNumber>::max()};
+    std::vector<KeyType> keys;
+    const auto collect = [&keys, &hi](const InternalKey& version) {
+        if (!(version.key < hi))
+        {
+            return false;
+        }
+        if (keys.empty() || !(keys.back() == version.key))
+        {
+            keys.push_back(version.key);
+        }
+        return true;
+    };
+
+    memtable_.ForEachFrom(first, [&collect](const InternalKey& version, const Record&) {
+        return collect(version);
+    });
+    for (const auto& run : runs_)
+    {
+        auto version = std::lower_bound(
+            run.begin(), run.end(), first, [](const auto& item, const auto& k) {
+                return item.first < k;
+            });
+        while (version != run.end() && collect(version->first)) { ++version; }
+    }
+
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    for (const auto& key : keys)
+    {
+        if (auto entry = Retrieve(key); entry && !visit(key, *entry))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+typename BasicSSTableLogger<TKey, TMemtable, Args...>::Snapshot
+BasicSSTableLogger<TKey, TMemtable, Args...>::GetSnapshot()
+{
+    snapshots_.insert(last_sequence_);
+    return Snapshot(last_sequence_);
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+void BasicSSTableLogger<TKey, TMemtable, Args...>::ReleaseSnapshot(const Snapshot& snapshot)
+{
+    if (const auto it = snapshots_.find(snapshot.Sequence()); it != snapshots_.end())
+    {
+        snapshots_.erase(it);
+    }
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+void BasicSSTableLogger<TKey, TMemtable, Args...>::Flush()
+{
+    if (memtable_.Empty())
+    {
+        return;
+    }
+
+    Run run;
+    memtable_.ForEach([&run](const InternalKey& key, const Record& record) {
+        run.emplace_back(key, record);
+        return true;
+    });
+    memtable_.Clear();
+    if constexpr (Hashable<KeyType>)
+    {
+        point_index_.Clear();
+    }
+    memtable_heap_bytes_ = 0;
+    memtable_memory_.Resize(0);
+    stats_.MemtableCleared();
+
+    run = Collapse(std::move(run), false);
+    if (!run.empty())
+    {
+        run_memory_.Resize(run_memory_.Bytes() + BytesOf(run));
+        runs_.push_back(std::move(run));
+    }
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+void BasicSSTableLogger<TKey, TMemtable, Args...>::Compact()
+{
+    // Sequence numbers are unique, so merging never meets two records with the same internal key.
+    Run merged;
+    for (auto& run : runs_)
+    {
+        Run next;
+        next.reserve(merged.size() + run.size());
+        std::merge(std::make_move_iterator(merged.begin()),
+                   std::make_move_iterator(merged.end()),
+                   std::make_move_iterator(run.begin()),
+                   std::make_move_iterator(run.end()),
+                   std::back_inserter(next),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+        merged = std::move(next);
+    }
+    runs_.clear();
+
+    merged = Collapse(std::move(merged), true);
+    run_memory_.Resize(BytesOf(merged));
+    if (!merged.empty())
+    {
+        runs_.push_back(std::move(merged));
+    }
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+std::optional<typename BasicSSTableLogger<TKey, TMemtable, Args...>::EntryType>
+BasicSSTableLogger<TKey, TMemtable, Args...>::ApplyOperands(std::optional<EntryType> base,
+                                                        std::vector<EntryType> operands) const
+{
+    if (!base && !operands.empty())
+    {
+        base = std::move(operands.back());
+        operands.pop_back();
+    }
+    for (auto operand = operands.rbegin(); operand != operands.rend(); ++operand)
+    { options_.merge_operator(*base, std::move(*operand)); }
+    return base;
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+bool BasicSSTableLogger<TKey, TMemtable, Args...>::IsExpired(const Record& record,
+                                                 Clock::time_point now) const
+{
+    return options_.ttl && now - record.logged_at >= *options_.ttl;
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+SSTableLoggerStats BasicSSTableLogger<TKey, TMemtable, Args...>::Stats() const
+{
+    SSTableLoggerStats stats;
+    stats_.Fill(stats);
+    stats.memtable_bytes = MemtableBytes();
+    stats.run_bytes = RunBytes();
+    stats.run_count = runs_.size();
+    for (const auto& run : runs_) { stats.run_entries += run.size(); }
+    return stats;
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+typename BasicSSTableLogger<TKey, TMemtable, Args...>::Run
+BasicSSTableLogger<TKey, TMemtable, Args...>::Collapse(Run run, bool bottommost) const
+{
+    const auto now = options_.clock();
+    Run collapsed;
+    collapsed.reserve(run.size());
+
+    for (auto version = run.begin(); version != run.end();)
+    {
+        const auto key = version->first.key;
+        const auto first_kept = collapsed.size();
+        // Sequence number of the next newer version of the same key.
+        auto newer_sequence = std::numeric_limits<SequenceNumber>::max();
+
+        for (; version != run.end() && version->first.key == key; ++version)
+        {
+            const auto sequence = version->first.sequence;
+            // The newest version is visible to current readers, the older ones only to snapshots.
+            const auto snapshot = snapshots_.lower_bound(sequence);
+            const auto visible = newer_sequence > last_sequence_
+                                 || (snapshot != snapshots_.end() && *snapshot < newer_sequence);
+            newer_sequence = sequence;
+
+            // Readers only check the newest version they see for expiry, and read through a merge
+            // operand into older versions however old they are. An expired version with no
+            // operand kept above it ends every read that reaches it, and the older versions are
+            // expired as well.
+            const auto read_through = collapsed.size() > first_kept
+                                      && collapsed.back().second.type == RecordType::kMergeOperand;
+            if (!read_through && IsExpired(version->second, now))
+            {
+                while (version != run.end() && version->first.key == key) { ++version; }
+                break;
+            }
+            if (visible)
+            {
+                collapsed.push_back(std::move(*version));
+                continue;
+            }
+
+            // Invisible versions only matter to the merge operand kept above them.
+            if (auto& kept = collapsed.back().second; kept.type == RecordType::kMergeOperand)
+            {
+                MergeInto(kept, std::move(version->second));
+            }
+        }
+
+        // With nothing older left to shadow, the oldest tombstones are indistinguishable from
+        // absent entries, and the oldest merge operand has nothing left to merge into.
+        while (bottommost && collapsed.size() > first_kept
+               && collapsed.back().second.type == RecordType::kTombstone)
+        { collapsed.pop_back(); }
+        if (bottommost && collapsed.size() > first_kept
+            && collapsed.back().second.type == RecordType::kMergeOperand)
+        { collapsed.back().second.type = RecordType::kValue; }
+    }
+
+    // Runs are kept for long, and their capacity counts towards the memory budget.
+    collapsed.shrink_to_fit();
+    return collapsed;
+}
+
+template <std::totally_ordered TKey,
+          template <typename, typename> class TMemtable,
+          typename... Args>
+void BasicSSTableLogger<TKey, TMemtable, Args...>::MergeInto(Record& operand, Record&& older) const
+{
+    switch (older.type)
+    {
+        case RecordType::kTombstone:
+            operand.type = RecordType::kValue;
+            return;
+        case RecordType::kValue:
+            operand.type = RecordType::kValue;
+            [[fallthrough]];
+        case RecordType::kMergeOperand:
+            options_.merge_operator(*older.entry, std::move(*operand.entry));
+            operand.entry = std::move(older.entry);
+            return;
+    }
 }
 
 #endif  // DATA_STRUCTURES_SS_TABLE_LOGGER_HPP
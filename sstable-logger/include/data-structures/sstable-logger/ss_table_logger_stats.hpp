@@ -0,0 +1,144 @@
+#ifndef DATA_STRUCTURES_SS_TABLE_LOGGER_STATS_HPP
+#define DATA_STRUCTURES_SS_TABLE_LOGGER_STATS_HPP
+
+#include <data-structures/instrumentation/stats.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+/**
+ * Statistics of a BasicSSTableLogger, see BasicSSTableLogger::Stats.
+ */
+struct SSTableLoggerStats
+{
+    /// Records written by Log, Erase, Merge and Write, one per write.
+    OperationStats append;
+    /// Retrieve calls. Their comparisons are the versions they visited.
+    OperationStats retrieve;
+
+    std::uint64_t values_logged = 0;
+    std::uint64_t tombstones_logged = 0;
+    std::uint64_t merge_operands_logged = 0;
+
+    /// Records in the memtable.
+    std::uint64_t memtable_entries = 0;
+    /// Bytes of the memtable, see BasicSSTableLogger::MemtableBytes. Always available.
+    std::uint64_t memtable_bytes = 0;
+    std::uint64_t run_count = 0;
+    /// Records in all runs.
+    std::uint64_t run_entries = 0;
+    /// Bytes of all runs, see BasicSSTableLogger::RunBytes. Always available.
+    std::uint64_t run_bytes = 0;
+
+    /// Lookups answered without leaving the memtable.
+    std::uint64_t retrieves_resolved_in_memtable = 0;
+    /// Lookups answered by a run, after the memtable and any newer runs.
+    std::uint64_t retrieves_resolved_in_runs = 0;
+    /// Lookups that searched the memtable and every run.
+    std::uint64_t retrieves_searched_everything = 0;
+    /// Runs searched by all lookups together.
+    std::uint64_t runs_searched = 0;
+};
+
+/**
+ * Counters of a BasicSSTableLogger. Empty, with all updates doing nothing, when kEnabled is false.
+ */
+template <bool kEnabled = kStatsEnabled>
+class SSTableLoggerCounters
+{
+public:
+    /**
+     * Counts a record inserted into the memtable.
+     * @param kind Counter of the kind of the record, such as &SSTableLoggerStats::values_logged.
+     */
+    void Logged(std::uint64_t SSTableLoggerStats::*kind)
+    {
+        ++(totals_.*kind);
+        ++totals_.memtable_entries;
+    }
+
+    void MemtableCleared()
+    {
+        totals_.memtable_entries = 0;
+    }
+
+    /**
+     * Counts a lookup.
+     * @param path Counter of the path the lookup took, such as
+     * &SSTableLoggerStats::retrieves_resolved_in_memtable.
+     * @note Lookups may run concurrently with each other, so their counters are updated atomically.
+     */
+    void Retrieved(std::uint64_t SSTableLoggerStats::*path, std::uint64_t runs_searched)
+    {
+        std::atomic_ref(lookups_.*path).fetch_add(1, std::memory_order_relaxed);
+        std::atomic_ref(lookups_.runs_searched).fetch_add(runs_searched, std::memory_order_relaxed);
+    }
+
+    /**
+     * Copies the counters into stats.
+     */
+    void Fill(SSTableLoggerStats& stats) const
+    {
+        stats = totals_;
+        for (const auto counter : {&SSTableLoggerStats::retrieves_resolved_in_memtable,
+                                   &SSTableLoggerStats::retrieves_resolved_in_runs,
+                                   &SSTableLoggerStats::retrieves_searched_everything,
+                                   &SSTableLoggerStats::runs_searched})
+        {
+            stats.*counter = std::atomic_ref(lookups_.*counter).load(std::memory_order_relaxed);
+        }
+        stats.append = append.Stats();
+        stats.retrieve = retrieve.Stats();
+    }
+
+    OperationCounter<kEnabled> append;
+    OperationCounter<kEnabled> retrieve;
+
+private:
+    /// Counters of writes and the memtable.
+    SSTableLoggerStats totals_;
+    /// Counters of lookup paths, mutable so that Fill can read them through std::atomic_ref.
+    mutable SSTableLoggerStats lookups_;
+};
+
+template <>
+class SSTableLoggerCounters<false>
+{
+public:
+    void Logged(std::uint64_t SSTableLoggerStats::*) {}
+
+    void MemtableCleared() {}
+
+    void Retrieved(std::uint64_t SSTableLoggerStats::*, std::uint64_t) {}
+
+    void Fill(SSTableLoggerStats&) const {}
+
+    // Static, so that the disabled counters take no space in the logger.
+    static inline OperationCounter<false> append;
+    static inline OperationCounter<false> retrieve;
+};
+
+inline std::string ToJson(const SSTableLoggerStats& stats)
+{
+    return JsonObject()
+        .AddRaw("append", ToJson(stats.append))
+        .AddRaw("retrieve", ToJson(stats.retrieve))
+        .Add("values_logged", stats.values_logged)
+        .Add("tombstones_logged", stats.tombstones_logged)
+        .Add("merge_operands_logged", stats.merge_operands_logged)
+        .Add("memtable_entries", stats.memtable_entries)
+        .Add("memtable_bytes", stats.memtable_bytes)
+        .Add("run_count", stats.run_count)
+        .Add("run_entries", stats.run_entries)
+        .Add("run_bytes", stats.run_bytes)
+        .Add("retrieves_resolved_in_memtable", stats.retrieves_resolved_in_memtable)
+        .Add("retrieves_resolved_in_runs", stats.retrieves_resolved_in_runs)
+        .Add("retrieves_searched_everything", stats.retrieves_searched_everything)
+        .Add("runs_searched", stats.runs_searched)
+        .Str();
+}
+
+#endif  // DATA_STRUCTURES_SS_TABLE_LOGGER_STATS_HPP
@@ -0,0 +1,310 @@
+#ifndef DATA_STRUCTURES_TAILING_SS_TABLE_LOGGER_HPP
+#define DATA_STRUCTURES_TAILING_SS_TABLE_LOGGER_HPP
+
+#include <data-structures/concurrency/channel.hpp>
+
+#include "ss_table_logger.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/**
+ * SSTableLogger that streams every write to the subscribers of the key range it falls into, so
+ * that consumers learn about new entries without polling the logger.
+ *
+ * A subscriber receives the writes through its own Channel, in the order they were applied, from
+ * any thread. Writes are published after they are applied, and a full channel applies its
+ * Backpressure to the writer: dropping the write for that subscriber, blocking the writer until
+ * the subscriber catches up, or spilling the write into an unbounded overflow list.
+ *
+ * @tparam TLogger logger to tail, an instantiation of BasicSSTableLogger
+ */
+template <typename TLogger>
+class TailingSSTableLogger
+{
+public:
+    using LoggerType = TLogger;
+    using KeyType = typename TLogger::KeyType;
+    using EntryType = typename TLogger::EntryType;
+    using Options = typename TLogger::Options;
+    using Snapshot = typename TLogger::Snapshot;
+
+    /**
+     * Write streamed to subscribers.
+     */
+    struct Event
+    {
+        KeyType key;
+        /// Entry logged under key, merged with the older versions for merges, or nullopt for
+        /// erasures.
+        std::optional<EntryType> entry;
+    };
+
+    using Subscription = std::shared_ptr<Channel<Event>>;
+
+    /**
+     * WriteBatch of the underlying logger that also remembers the writes to publish.
+     */
+    class WriteBatch
+    {
+    public:
+        template <typename... Args>
+        void Log(KeyType key, Args&&... args)
+        {
+            batch_.Log(key, args...);
+            writes_.push_back({{std::move(key), EntryType(std::forward<Args>(args)...)}, false});
+        }
+
+        void Erase(KeyType key)
+        {
+            batch_.Erase(key);
+            writes_.push_back({{std::move(key), std::nullopt}, false});
+        }
+
+        template <typename... Args>
+        void Merge(KeyType key, Args&&... args)
+        {
+            batch_.Merge(key, std::forward<Args>(args)...);
+            writes_.push_back({{std::move(key), std::nullopt}, true});
+        }
+
+    private:
+        friend TailingSSTableLogger;
+
+        struct Write
+        {
+            Event event;
+            /// Whether the entry of the event has to be read back from the logger.
+            bool merged;
+        };
+
+        typename TLogger::WriteBatch batch_;
+        std::vector<Write> writes_;
+    };
+
+    TailingSSTableLogger() = default;
+
+    explicit TailingSSTableLogger(Options options) : logger_(std::move(options)) {}
+
+    TailingSSTableLogger(const TailingSSTableLogger&) = delete;
+    TailingSSTableLogger& operator=(const TailingSSTableLogger&) = delete;
+
+    /**
+     * Closes all subscriptions, so that their receivers stop once they drain them.
+     */
+    ~TailingSSTableLogger();
+
+    /**
+     * Subscribes to the writes to keys in [lo, hi) applied from now on.
+     * @param capacity Capacity of the channel, see Channel.
+     * @param backpressure What a write does when the channel is full.
+     * @return Channel to receive the writes from. Closing it unsubscribes.
+     * @note With Backpressure::kBlock, a subscriber that stops receiving blocks all writers.
+     */
+    Subscription Subscribe(KeyType lo,
+                           KeyType hi,
+                           std::size_t capacity,
+                           Backpressure backpressure = Backpressure::kDrop);
+
+    /**
+     * @return Number of open subscriptions.
+     */
+    std::size_t SubscriptionCount() const
+    {
+        return std::count_if(subscribers_.begin(), subscribers_.end(), [](const auto& subscriber) {
+            return !subscriber.channel->Closed();
+        });
+    }
+
+    template <typename... Args>
+    void Log(KeyType key, Args&&... args);
+
+    void Erase(KeyType key);
+
+    /**
+     * Merges an entry into the one logged under key, and publishes the result, which is read back
+     * from the logger. See BasicSSTableLogger::Merge.
+     */
+    template <typename... Args>
+    void Merge(KeyType key, Args&&... args);
+
+    /**
+     * Applies all writes in the batch and then publishes them, in the order they were added.
+     */
+    void Write(WriteBatch batch);
+
+    std::optional<EntryType> Retrieve(KeyType key)
+    {
+        return logger_.Retrieve(std::move(key));
+    }
+
+    std::optional<EntryType> Retrieve(KeyType key, const Snapshot& snapshot)
+    {
+        return logger_.Retrieve(std::move(key), snapshot);
+    }
+
+    template <typename TVisitor>
+    bool Scan(const KeyType& lo, const KeyType& hi, TVisitor&& visit)
+    {
+        return logger_.Scan(lo, hi, std::forward<TVisitor>(visit));
+    }
+
+    Snapshot GetSnapshot()
+    {
+        return logger_.GetSnapshot();
+    }
+
+    void ReleaseSnapshot(const Snapshot& snapshot)
+    {
+        logger_.ReleaseSnapshot(snapshot);
+    }
+
+    void Flush()
+    {
+        logger_.Flush();
+    }
+
+    void Compact()
+    {
+        logger_.Compact();
+    }
+
+    SSTableLoggerStats Stats() const
+    {
+        return logger_.Stats();
+    }
+
+private:
+    struct Subscriber
+    {
+        KeyType lo;
+        KeyType hi;
+        Subscription channel;
+    };
+
+    bool HasSubscriber(const KeyType& key) const;
+
+    /**
+     * Sends the event to the subscribers of its key, and drops the subscriptions closed by their
+     * receivers.
+     */
+    void Publish(Event event);
+
+    TLogger logger_;
+    std::vector<Subscriber> subscribers_;
+};
+
+template <typename TLogger>
+TailingSSTableLogger<TLogger>::~TailingSSTableLogger()
+{
+    for (const auto& subscriber : subscribers_) { subscriber.channel->Close(); }
+}
+
+template <typename TLogger>
+typename TailingSSTableLogger<TLogger>::Subscription
+TailingSSTableLogger<TLogger>::Subscribe(KeyType lo,
+                                         KeyType hi,
+                                         std::size_t capacity,
+                                         Backpressure backpressure)
+{
+    auto channel = std::make_shared<Channel<Event>>(capacity, backpressure);
+    subscribers_.push_back({std::move(lo), std::move(hi), channel});
+    return channel;
+}
+
+template <typename TLogger>
+template <typename... Args>
+void TailingSSTableLogger<TLogger>::Log(KeyType key, Args&&... args)
+{
+    if (!HasSubscriber(key))
+    {
+        logger_.Log(std::move(key), std::forward<Args>(args)...);
+        return;
+    }
+    // The entry is copied for the subscribers before the arguments are moved into the logger.
+    Event event{key, EntryType(args...)};
+    logger_.Log(std::move(key), std::forward<Args>(args)...);
+    Publish(std::move(event));
+}
+
+template <typename TLogger>
+void TailingSSTableLogger<TLogger>::Erase(KeyType key)
+{
+    logger_.Erase(key);
+    if (HasSubscriber(key))
+    {
+        Publish({std::move(key), std::nullopt});
+    }
+}
+
+template <typename TLogger>
+template <typename... Args>
+void TailingSSTableLogger<TLogger>::Merge(KeyType key, Args&&... args)
+{
+    logger_.Merge(key, std::forward<Args>(args)...);
+    if (HasSubscriber(key))
+    {
+        auto merged = logger_.Retrieve(key);
+        Publish({std::move(key), std::move(merged)});
+    }
+}
+
+template <typename TLogger>
+void TailingSSTableLogger<TLogger>::Write(WriteBatch batch)
+{
+    logger_.Write(std::move(batch.batch_));
+    for (auto& write : batch.writes_)
+    {
+        if (!HasSubscriber(write.event.key))
+        {
+            continue;
+        }
+        if (write.merged)
+        {
+            // A merge is published with the entry at the end of the batch, which includes any
+            // later writes to the same key in the batch.
+            write.event.entry = logger_.Retrieve(write.event.key);
+        }
+        Publish(std::move(write.event));
+    }
+}
+
+template <typename TLogger>
+bool TailingSSTableLogger<TLogger>::HasSubscriber(const KeyType& key) const
+{
+    return std::any_of(subscribers_.begin(), subscribers_.end(), [&](const auto& subscriber) {
+        return !(key < subscriber.lo) && key < subscriber.hi;
+    });
+}
+
+template <typename TLogger>
+void TailingSSTableLogger<TLogger>::Publish(Event event)
+{
+    std::erase_if(subscribers_,
+                  [](const auto& subscriber) { return subscriber.channel->Closed(); });
+
+    Subscriber* last = nullptr;
+    for (auto& subscriber : subscribers_)
+    {
+        if (event.key < subscriber.lo || !(event.key < subscriber.hi))
+        {
+            continue;
+        }
+        // Every subscriber but the last one gets a copy.
+        if (last)
+        {
+            last->channel->Send(event);
+        }
+        last = &subscriber;
+    }
+    if (last)
+    {
+        last->channel->Send(std::move(event));
+    }
+}
+
+#endif  // DATA_STRUCTURES_TAILING_SS_TABLE_LOGGER_HPP
@@ -0,0 +1,163 @@
+#include <data-structures/concurrency/task.hpp>
+#include <data-structures/concurrency/work_stealing_thread_pool.hpp>
+#include <data-structures/sstable-logger/async_ss_table_logger.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+using Logger = AsyncSSTableLogger<SSTableLogger<int, std::string>>;
+
+/**
+ * @return 0, so that writers can be awaited together with CheckReads.
+ */
+Task<int> LogRange(Logger& logger, int begin, int end)
+{
+    for (auto key = begin; key < end; ++key)
+    { co_await logger.LogAsync(key, key, std::to_string(key)); }
+    co_return 0;
+}
+
+/**
+ * Flushes and compacts the logger rounds times.
+ * @return 0, so that it can be awaited together with CheckReads.
+ */
+Task<int> FlushAndCompact(Logger& logger, int rounds)
+{
+    for (auto round = 0; round < rounds; ++round)
+    {
+        co_await logger.FlushAsync();
+        co_await logger.CompactAsync();
+    }
+    co_return 0;
+}
+
+/**
+ * Reads the keys in [begin, end) passes times while they are being logged by LogRange.
+ * @return Number of reads that found a damaged entry, or no entry for a key found before.
+ */
+Task<int> CheckReads(Logger& logger, int begin, int end, int passes)
+{
+    auto errors = 0;
+    std::vector<bool> found(end - begin);
+    for (auto pass = 0; pass < passes; ++pass)
+    {
+        for (auto key = begin; key < end; ++key)
+        {
+            const auto entry = co_await logger.RetrieveAsync(key);
+            if (entry)
+            {
+                errors += entry != std::make_tuple(key, std::to_string(key));
+                found[key - begin] = true;
+            }
+            else
+            {
+                errors += found[key - begin];
+            }
+        }
+    }
+    co_return errors;
+}
+
+/**
+ * @return Number of keys in [begin, end) whose entry was retrieved intact.
+ */
+Task<int> CountIntact(Logger& logger, int begin, int end)
+{
+    auto intact = 0;
+    for (auto key = begin; key < end; ++key)
+    {
+        const auto entry = co_await logger.RetrieveAsync(key);
+        intact += entry == std::make_tuple(key, std::to_string(key));
+    }
+    co_return intact;
+}
+}  // namespace
+
+TEST(AsyncSSTableLoggerTest, LogAndRetrieve)
+{
+    WorkStealingThreadPool pool(2);
+    Logger logger(pool);
+
+    SyncWait(logger.LogAsync(1, 10, std::string("a")));
+    SyncWait(logger.LogAsync(2, 20, std::string("b")));
+    SyncWait(logger.FlushAsync());
+    SyncWait(logger.EraseAsync(1));
+
+    EXPECT_EQ(SyncWait(logger.RetrieveAsync(1)), std::nullopt);
+    EXPECT_EQ(SyncWait(logger.RetrieveAsync(2)), std::make_tuple(20, std::string("b")));
+
+    SyncWait(logger.CompactAsync());
+    EXPECT_EQ(SyncWait(logger.RetrieveAsync(2)), std::make_tuple(20, std::string("b")));
+    EXPECT_EQ(logger.Stats().run_count, 1u);
+}
+
+TEST(AsyncSSTableLoggerTest, ConcurrentWritersAndReaders)
+{
+    WorkStealingThreadPool pool(4);
+    Logger logger(pool);
+
+    // Readers, flushes and compactions are interleaved with the writers, so that lookups run
+    // while the logger is being written to, flushed and compacted.
+    std::vector<Task<int>> tasks;
+    for (auto range = 0; range < 8; ++range)
+    {
+        tasks.push_back(LogRange(logger, range * 100, (range + 1) * 100));
+        tasks.push_back(CheckReads(logger, range * 100, (range + 1) * 100, 4));
+        if (range % 4 == 0)
+        {
+            tasks.push_back(FlushAndCompact(logger, 10));
+        }
+    }
+    for (const auto errors : SyncWaitAll(std::move(tasks))) { EXPECT_EQ(errors, 0); }
+
+    std::vector<Task<int>> readers;
+    for (auto reader = 0; reader < 8; ++reader)
+    { readers.push_back(CountIntact(logger, reader * 100, (reader + 1) * 100)); }
+    for (const auto intact : SyncWaitAll(std::move(readers))) { EXPECT_EQ(intact, 100); }
+}
+
+TEST(AsyncSSTableLoggerTest, StalledWriteDoesNotBlockReaders)
+{
+    using namespace std::chrono_literals;
+    MemoryBudget::Options budget_options;
+    budget_options.max_stall = 10s;
+    auto budget = std::make_shared<MemoryBudget>(1 << 14, budget_options);
+
+    // Another logger holds the whole budget, so a write to the async logger stalls until it
+    // flushes.
+    Logger::Options holder_options;
+    holder_options.memory_budget = budget;
+    Logger::LoggerType holder(holder_options);
+    for (auto key = 0; !budget->Exhausted(); ++key) { holder.Log(key, key, std::to_string(key)); }
+
+    WorkStealingThreadPool pool(2);
+    Logger::Options options;
+    options.memory_budget = budget;
+    Logger logger(pool, options);
+    SyncWait(logger.FlushAsync());
+
+    std::atomic<bool> written = false;
+    std::thread writer([&] {
+        SyncWait(logger.LogAsync(1, 1, std::string("1")));
+        written = true;
+    });
+    while (budget->Stats().stalled_writes == 0) { std::this_thread::yield(); }
+
+    EXPECT_EQ(SyncWait(logger.RetrieveAsync(1)), std::nullopt);
+    EXPECT_FALSE(written);
+
+    holder.Flush();
+    writer.join();
+    EXPECT_EQ(SyncWait(logger.RetrieveAsync(1)), std::make_tuple(1, std::string("1")));
+    EXPECT_EQ(budget->Stats().stall_timeouts, 0u);
+}
@@ -0,0 +1,157 @@
+#include <data-structures/sstable-logger/ss_table_logger.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <utility>
+
+namespace
+{
+using Logger = SSTableLogger<int, std::string>;
+using namespace std::chrono_literals;
+
+class ManualClock
+{
+public:
+    Logger::Clock::time_point Now() const
+    {
+        return now_;
+    }
+
+    void Advance(Logger::Clock::duration duration)
+    {
+        now_ += duration;
+    }
+
+private:
+    Logger::Clock::time_point now_{};
+};
+
+Logger MakeLoggerWithTtl(ManualClock& clock, Logger::Clock::duration ttl)
+{
+    Logger::Options options;
+    options.ttl = ttl;
+    options.clock = [&clock] { return clock.Now(); };
+    return Logger(std::move(options));
+}
+}  // namespace
+
+TEST(SSTableLoggerEraseTest, EraseFromMemtable)
+{
+    Logger logger;
+    logger.Log(1, 11, "eleven");
+    logger.Log(2, 22, "twenty two");
+
+    logger.Erase(1);
+
+    EXPECT_FALSE(logger.Retrieve(1));
+    EXPECT_TRUE(logger.Retrieve(2));
+}
+
+TEST(SSTableLoggerEraseTest, TombstoneShadowsFlushedEntry)
+{
+    Logger logger;
+    logger.Log(1, 11, "eleven");
+    logger.Flush();
+
+    logger.Erase(1);
+    EXPECT_FALSE(logger.Retrieve(1));
+
+    logger.Flush();
+    EXPECT_FALSE(logger.Retrieve(1));
+
+    logger.Compact();
+    EXPECT_FALSE(logger.Retrieve(1));
+}
+
+TEST(SSTableLoggerEraseTest, LogAfterEraseIsRetrieved)
+{
+    Logger logger;
+    logger.Log(1, 11, "eleven");
+    logger.Erase(1);
+    logger.Flush();
+    logger.Log(1, 111, "one hundred eleven");
+
+    const auto result = logger.Retrieve(1);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::make_tuple(111, std::string("one hundred eleven")), *result);
+}
+
+TEST(SSTableLoggerEraseTest, NewerRunShadowsOlderAfterCompaction)
+{
+    Logger logger;
+    logger.Log(1, 11, "eleven");
+    logger.Log(2, 22, "twenty two");
+    logger.Flush();
+    logger.Log(2, 222, "two hundred twenty two");
+    logger.Log(3, 33, "thirty three");
+    logger.Flush();
+
+    logger.Compact();
+
+    EXPECT_EQ(std::make_tuple(11, std::string("eleven")), logger.Retrieve(1));
+    EXPECT_EQ(std::make_tuple(222, std::string("two hundred twenty two")), logger.Retrieve(2));
+    EXPECT_EQ(std::make_tuple(33, std::string("thirty three")), logger.Retrieve(3));
+}
+
+TEST(SSTableLoggerTtlTest, ExpiredEntryIsNotRetrieved)
+{
+    ManualClock clock;
+    auto logger = MakeLoggerWithTtl(clock, 10s);
+    logger.Log(1, 11, "eleven");
+
+    clock.Advance(5s);
+    logger.Log(2, 22, "twenty two");
+    EXPECT_TRUE(logger.Retrieve(1));
+
+    clock.Advance(5s);
+    EXPECT_FALSE(logger.Retrieve(1));
+    EXPECT_TRUE(logger.Retrieve(2));
+}
+
+TEST(SSTableLoggerTtlTest, RelogRefreshesExpiry)
+{
+    ManualClock clock;
+    auto logger = MakeLoggerWithTtl(clock, 10s);
+    logger.Log(1, 11, "eleven");
+
+    clock.Advance(8s);
+    logger.Log(1, 111, "one hundred eleven");
+
+    clock.Advance(8s);
+    EXPECT_EQ(std::make_tuple(111, std::string("one hundred eleven")), logger.Retrieve(1));
+}
+
+TEST(SSTableLoggerTtlTest, ExpiredEntryDoesNotExposeOlderVersion)
+{
+    ManualClock clock;
+    auto logger = MakeLoggerWithTtl(clock, 10s);
+    logger.Log(1, 11, "eleven");
+    logger.Flush();
+    logger.Log(1, 111, "one hundred eleven");
+
+    clock.Advance(10s);
+    EXPECT_FALSE(logger.Retrieve(1));
+}
+
+TEST(SSTableLoggerTtlTest, ExpiredEntriesAreDroppedOnFlushAndCompact)
+{
+    ManualClock clock;
+    auto logger = MakeLoggerWithTtl(clock, 10s);
+    logger.Log(1, 11, "eleven");
+    logger.Flush();
+
+    clock.Advance(5s);
+    logger.Log(2, 22, "twenty two");
+
+    clock.Advance(5s);
+    logger.Flush();
+    logger.Compact();
+    EXPECT_FALSE(logger.Retrieve(1));
+    EXPECT_TRUE(logger.Retrieve(2));
+
+    // The surviving entry still expires ttl after it was logged.
+    clock.Advance(5s);
+    EXPECT_FALSE(logger.Retrieve(2));
+}
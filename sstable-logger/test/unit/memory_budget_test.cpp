@@ -0,0 +1,269 @@
+#include <data-structures/sstable-logger/memory_budget.hpp>
+#include <data-structures/sstable-logger/ss_table_logger.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+using Logger = SSTableLogger<std::string>;
+
+Logger MakeLogger(std::shared_ptr<MemoryBudget> budget)
+{
+    Logger::Options options;
+    options.memory_budget = std::move(budget);
+    return Logger(std::move(options));
+}
+
+/**
+ * Logs entries under a few keys until the budget is exhausted, so that flushing leaves only their
+ * latest versions.
+ */
+void LogUntilExhausted(Logger& logger, const MemoryBudget& budget)
+{
+    for (std::int64_t key = 0; !budget.Exhausted(); ++key) { logger.Log(key % 8, "entry"); }
+}
+}  // namespace
+
+TEST(MemoryBudgetTest, MemtableBytesCountNodesAndHeapMemory)
+{
+    Logger short_entries;
+    Logger long_entries;
+    const std::string long_string(1000, 'x');
+    for (std::int64_t key = 0; key < 10; ++key)
+    {
+        short_entries.Log(key, "short");
+        long_entries.Log(key, long_string);
+    }
+
+    EXPECT_GT(short_entries.MemtableBytes(), 10 * sizeof(std::string));
+    EXPECT_GE(long_entries.MemtableBytes(), short_entries.MemtableBytes() + 10 * 1000);
+    EXPECT_EQ(long_entries.Stats().memtable_bytes, long_entries.MemtableBytes());
+
+    long_entries.Flush();
+    EXPECT_EQ(long_entries.MemtableBytes(), 0u);
+
+    BasicSSTableLogger<std::string, ARTMemtable, std::string> art;
+    art.Log(std::string(100, 'k'), long_string);
+    EXPECT_GE(art.MemtableBytes(), 2 * 100 + 1000u);
+}
+
+TEST(MemoryBudgetTest, LoggersShareTheBudget)
+{
+    auto budget = std::make_shared<MemoryBudget>(1 << 20);
+    auto first = MakeLogger(budget);
+    {
+        auto second = MakeLogger(budget);
+        first.Log(1, "a");
+        second.Log(1, std::string(1000, 'b'));
+        EXPECT_EQ(budget->Used(), first.MemtableBytes() + second.MemtableBytes());
+    }
+    // Destroying a logger releases its memtable.
+    EXPECT_EQ(budget->Used(), first.MemtableBytes());
+
+    first.Flush();
+    EXPECT_EQ(budget->Used(), 0u);
+    EXPECT_EQ(budget->RunBytes(), first.RunBytes());
+    EXPECT_GT(budget->Stats().peak, 1000u);
+}
+
+TEST(MemoryBudgetTest, RunsAreReportedToTheBudget)
+{
+    auto budget = std::make_shared<MemoryBudget>(1 << 20);
+    {
+        auto logger = MakeLogger(budget);
+        for (std::int64_t key = 0; key < 10; ++key) { logger.Log(key, std::string(1000, 'a')); }
+        logger.Flush();
+        EXPECT_GE(logger.RunBytes(), 10 * 1000u);
+        EXPECT_EQ(logger.Stats().run_bytes, logger.RunBytes());
+
+        for (std::int64_t key = 0; key < 10; ++key) { logger.Log(key, "b"); }
+        logger.Flush();
+        const auto before_compaction = logger.RunBytes();
+        EXPECT_EQ(budget->RunBytes(), before_compaction);
+        EXPECT_EQ(budget->Used(), 0u);
+
+        // Compaction drops the shadowed long entries.
+        logger.Compact();
+        EXPECT_LT(logger.RunBytes() + 10 * 1000, before_compaction);
+        EXPECT_EQ(budget->Stats().run_bytes, logger.RunBytes());
+    }
+    EXPECT_EQ(budget->RunBytes(), 0u);
+}
+
+TEST(MemoryBudgetTest, WriteDelayGrowsTowardsTheLimit)
+{
+    MemoryBudget::Options options;
+    options.slowdown_ratio = 0.5;
+    options.max_delay = 1000ns;
+    MemoryBudget budget(1000, options);
+
+    budget.Reserve(500);
+    EXPECT_EQ(budget.WriteDelay(), 0ns);
+    budget.Reserve(250);
+    EXPECT_EQ(budget.WriteDelay(), 500ns);
+    budget.Reserve(200);
+    EXPECT_EQ(budget.WriteDelay(), 900ns);
+    budget.Reserve(50);
+    EXPECT_TRUE(budget.Exhausted());
+    EXPECT_EQ(budget.WriteDelay(), 0ns);
+}
+
+TEST(MemoryBudgetTest, ThrottlesWritesAboveSlowdownThreshold)
+{
+    MemoryBudget::Options options;
+    options.slowdown_ratio = 0.5;
+    options.max_delay = 100us;
+    options.sleep_quantum = 100us;
+    auto budget = std::make_shared<MemoryBudget>(1 << 14, options);
+    auto logger = MakeLogger(budget);
+    for (std::int64_t key = 0; budget->Used() < budget->Limit() * 3 / 4; ++key)
+    { logger.Log(key, "entry"); }
+
+    const auto stats = budget->Stats();
+    EXPECT_GT(stats.throttled_writes, 0u);
+    EXPECT_GT(stats.throttle_ns, 0u);
+    EXPECT_EQ(stats.stalled_writes, 0u);
+}
+
+TEST(MemoryBudgetTest, ThrottleDebtIsOwedPerThread)
+{
+    MemoryBudget::Options options;
+    options.slowdown_ratio = 0.5;
+    options.max_delay = 1000ns;
+    options.sleep_quantum = 1ms;
+    MemoryBudget budget(1000, options);
+    budget.Reserve(750);
+
+    // Fresh threads, which owe nothing from earlier writes.
+    std::thread([&budget] {
+        // Each write owes 500ns, so this thread stays just below the quantum.
+        for (int write = 0; write < 1999; ++write) { budget.AdmitWrite([] {}); }
+        // Another thread does not sleep off the debt of this one.
+        std::thread([&budget] { budget.AdmitWrite([] {}); }).join();
+        EXPECT_EQ(budget.Stats().throttled_writes, 2000u);
+        EXPECT_EQ(budget.Stats().throttle_ns, 0u);
+
+        budget.AdmitWrite([] {});
+        EXPECT_GE(budget.Stats().throttle_ns, 1'000'000u);
+    }).join();
+}
+
+TEST(MemoryBudgetTest, WriteAdmittedAheadIsThrottledOnce)
+{
+    MemoryBudget::Options options;
+    options.slowdown_ratio = 0.5;
+    MemoryBudget budget(1000, options);
+    budget.Reserve(750);
+
+    budget.AdmitWriteAhead([] {});
+    budget.AdmitWrite([] {});
+    EXPECT_EQ(budget.Stats().throttled_writes, 1u);
+    budget.AdmitWrite([] {});
+    EXPECT_EQ(budget.Stats().throttled_writes, 2u);
+}
+
+TEST(MemoryBudgetTest, WriteAdmittedAheadIsStalledOnce)
+{
+    MemoryBudget::Options options;
+    options.max_stall = 1ms;
+    MemoryBudget budget(1000, options);
+    budget.Reserve(1000);
+
+    auto relieved = 0;
+    budget.AdmitWriteAhead([&relieved] { ++relieved; });
+    budget.AdmitWrite([&relieved] { ++relieved; });
+    EXPECT_EQ(relieved, 1);
+    EXPECT_EQ(budget.Stats().stalled_writes, 1u);
+    EXPECT_EQ(budget.Stats().stall_timeouts, 1u);
+}
+
+TEST(MemoryBudgetTest, StalledWriteFlushesItsMemtable)
+{
+    auto budget = std::make_shared<MemoryBudget>(1 << 14);
+    auto logger = MakeLogger(budget);
+    LogUntilExhausted(logger, *budget);
+    EXPECT_EQ(logger.Stats().run_count, 0u);
+
+    logger.Log(-1, "stalled");
+    EXPECT_EQ(logger.Stats().run_count, 1u);
+    EXPECT_FALSE(budget->Exhausted());
+    EXPECT_EQ(budget->Stats().stalled_writes, 1u);
+    EXPECT_EQ(budget->Stats().stall_timeouts, 0u);
+    EXPECT_EQ(logger.Retrieve(0), std::make_tuple(std::string("entry")));
+}
+
+TEST(MemoryBudgetTest, RunsDoNotStallWrites)
+{
+    MemoryBudget::Options options;
+    options.max_stall = 10s;
+    auto budget = std::make_shared<MemoryBudget>(1 << 16, options);
+    auto logger = MakeLogger(budget);
+
+    // Every key is new, so the runs keep growing past the limit, while each stall frees the whole
+    // memtable.
+    constexpr std::int64_t kKeys = 20000;
+    for (std::int64_t key = 0; key < kKeys; ++key) { logger.Log(key, "entry"); }
+
+    const auto stats = budget->Stats();
+    EXPECT_GT(stats.stalled_writes, 0u);
+    EXPECT_EQ(stats.stall_timeouts, 0u);
+    EXPECT_LT(stats.peak, budget->Limit() + 1024);
+    EXPECT_FALSE(budget->Exhausted());
+    EXPECT_GT(stats.run_bytes, 4 * budget->Limit());
+    EXPECT_EQ(stats.run_bytes, logger.RunBytes());
+    EXPECT_EQ(logger.Retrieve(0), std::make_tuple(std::string("entry")));
+    EXPECT_EQ(logger.Retrieve(kKeys - 1), std::make_tuple(std::string("entry")));
+}
+
+TEST(MemoryBudgetTest, StalledWriteWaitsForOtherLoggers)
+{
+    MemoryBudget::Options options;
+    options.max_stall = 10s;
+    auto budget = std::make_shared<MemoryBudget>(1 << 14, options);
+    auto holder = MakeLogger(budget);
+    LogUntilExhausted(holder, *budget);
+
+    std::thread releaser([&holder] {
+        std::this_thread::sleep_for(20ms);
+        holder.Flush();
+    });
+    auto writer = MakeLogger(budget);
+    writer.Log(1, "waited");
+    releaser.join();
+
+    const auto stats = budget->Stats();
+    EXPECT_EQ(stats.stalled_writes, 1u);
+    EXPECT_EQ(stats.stall_timeouts, 0u);
+    EXPECT_GE(stats.stall_ns, 10'000'000u);
+    EXPECT_EQ(writer.Stats().run_count, 0u);
+}
+
+TEST(MemoryBudgetTest, StalledWriteGivesUpAfterMaxStall)
+{
+    MemoryBudget::Options options;
+    options.max_stall = 5ms;
+    auto budget = std::make_shared<MemoryBudget>(1 << 14, options);
+    auto holder = MakeLogger(budget);
+    LogUntilExhausted(holder, *budget);
+
+    auto writer = MakeLogger(budget);
+    writer.Log(1, "over the limit");
+    EXPECT_EQ(budget->Stats().stall_timeouts, 1u);
+    EXPECT_EQ(writer.Retrieve(1), std::make_tuple(std::string("over the limit")));
+}
+
+TEST(MemoryBudgetTest, Json)
+{
+    MemoryBudget budget(100);
+    budget.Reserve(10);
+    EXPECT_EQ(ToJson(budget.Stats()),
+              "{\"limit\":100,\"used\":10,\"peak\":10,\"run_bytes\":0,\"throttled_writes\":0,"
+              "\"throttle_ns\":0,\"stalled_writes\":0,\"stall_ns\":0,\"stall_timeouts\":0}");
+}
@@ -0,0 +1,118 @@
+#include <data-structures/sstable-logger/ss_table_logger.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+
+namespace
+{
+std::int64_t MakeKey(std::int64_t key, std::int64_t*)
+{
+    return key;
+}
+
+std::string MakeKey(std::int64_t key, std::string*)
+{
+    // Zero-padded keys sort like the integers; the embedded zero byte exercises escaping.
+    auto digits = std::to_string(key);
+    return std::string("key\0", 4) + std::string(8 - digits.size(), '0') + digits;
+}
+}  // namespace
+
+template <typename TLogger>
+class MemtableBackendTest : public testing::Test
+{
+protected:
+    using Logger = TLogger;
+    using KeyType = typename TLogger::KeyType;
+
+    static KeyType Key(std::int64_t key)
+    {
+        return MakeKey(key, static_cast<KeyType*>(nullptr));
+    }
+};
+
+using Loggers = testing::Types<BasicSSTableLogger<std::int64_t, BSTMemtable, int>,
+                               BasicSSTableLogger<std::int64_t, ARTMemtable, int>,
+                               BasicSSTableLogger<std::string, BSTMemtable, int>,
+                               BasicSSTableLogger<std::string, ARTMemtable, int>>;
+TYPED_TEST_SUITE(MemtableBackendTest, Loggers);
+
+TYPED_TEST(MemtableBackendTest, LogAndRetrieve)
+{
+    typename TestFixture::Logger logger;
+    logger.Log(this->Key(2), 2);
+    logger.Log(this->Key(1), 1);
+    logger.Log(this->Key(2), 22);
+
+    EXPECT_EQ(logger.Retrieve(this->Key(1)), std::make_tuple(1));
+    EXPECT_EQ(logger.Retrieve(this->Key(2)), std::make_tuple(22));
+    EXPECT_FALSE(logger.Retrieve(this->Key(3)));
+}
+
+TYPED_TEST(MemtableBackendTest, EraseAndSnapshots)
+{
+    typename TestFixture::Logger logger;
+    logger.Log(this->Key(1), 1);
+    const auto snapshot = logger.GetSnapshot();
+    logger.Erase(this->Key(1));
+    logger.Flush();
+    logger.Log(this->Key(1), 11);
+    const auto erased_snapshot = logger.GetSnapshot();
+    logger.Erase(this->Key(1));
+
+    EXPECT_FALSE(logger.Retrieve(this->Key(1)));
+    EXPECT_EQ(logger.Retrieve(this->Key(1), snapshot), std::make_tuple(1));
+    EXPECT_EQ(logger.Retrieve(this->Key(1), erased_snapshot), std::make_tuple(11));
+
+    logger.Compact();
+    EXPECT_FALSE(logger.Retrieve(this->Key(1)));
+    EXPECT_EQ(logger.Retrieve(this->Key(1), snapshot), std::make_tuple(1));
+}
+
+TYPED_TEST(MemtableBackendTest, MatchesMapAcrossFlushesAndCompactions)
+{
+    std::mt19937 random(7);
+    std::uniform_int_distribution<std::int64_t> keys(0, 500);
+    std::uniform_int_distribution<int> operations(0, 99);
+
+    typename TestFixture::Logger logger;
+    std::map<std::int64_t, int> expected;
+    for (int operation = 0; operation < 5000; ++operation)
+    {
+        const auto key = keys(random);
+        const auto kind = operations(random);
+        if (kind < 70)
+        {
+            logger.Log(this->Key(key), operation);
+            expected[key] = operation;
+        }
+        else if (kind < 95)
+        {
+            logger.Erase(this->Key(key));
+            expected.erase(key);
+        }
+        else if (kind < 99)
+        {
+            logger.Flush();
+        }
+        else
+        {
+            logger.Compact();
+        }
+    }
+
+    for (std::int64_t key = 0; key <= 500; ++key)
+    {
+        const auto it = expected.find(key);
+        const auto retrieved = logger.Retrieve(this->Key(key));
+        ASSERT_EQ(retrieved.has_value(), it != expected.end()) << key;
+        if (retrieved)
+        {
+            EXPECT_EQ(std::get<0>(*retrieved), it->second) << key;
+        }
+    }
+}
@@ -0,0 +1,176 @@
+#include <data-structures/sstable-logger/ss_table_logger.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace
+{
+using Logger = SSTableLogger<int, std::vector<std::string>>;
+
+void MergeCounterAndTags(Logger::EntryType& existing, Logger::EntryType&& update)
+{
+    std::get<0>(existing) += std::get<0>(update);
+    auto& tags = std::get<1>(existing);
+    tags.insert(tags.end(), std::get<1>(update).begin(), std::get<1>(update).end());
+}
+
+Logger MakeLogger(Logger::MergeMode merge_mode)
+{
+    Logger::Options options;
+    options.merge_operator = &MergeCounterAndTags;
+    options.merge_mode = merge_mode;
+    return Logger(std::move(options));
+}
+
+Logger MakeLoggerWithTtl(Logger::MergeMode merge_mode,
+                         Logger::Clock::duration ttl,
+                         const Logger::Clock::time_point& now)
+{
+    Logger::Options options;
+    options.ttl = ttl;
+    options.clock = [&now] { return now; };
+    options.merge_operator = &MergeCounterAndTags;
+    options.merge_mode = merge_mode;
+    return Logger(std::move(options));
+}
+}  // namespace
+
+class SSTableLoggerMergeTest : public testing::TestWithParam<Logger::MergeMode>
+{
+};
+
+TEST_P(SSTableLoggerMergeTest, MergeIntoMissingEntryLogsOperand)
+{
+    auto logger = MakeLogger(GetParam());
+    logger.Merge(1, 5, {"a"});
+
+    EXPECT_EQ(std::make_tuple(5, std::vector<std::string>{"a"}), logger.Retrieve(1));
+}
+
+TEST_P(SSTableLoggerMergeTest, MergesAccumulateInOrder)
+{
+    auto logger = MakeLogger(GetParam());
+    logger.Log(1, 1, {"a"});
+    logger.Merge(1, 2, {"b"});
+    logger.Flush();
+    logger.Merge(1, 3, {"c"});
+    logger.Merge(2, 4, {"d"});
+
+    const Logger::EntryType expected{6, {"a", "b", "c"}};
+    EXPECT_EQ(expected, logger.Retrieve(1));
+    EXPECT_EQ(std::make_tuple(4, std::vector<std::string>{"d"}), logger.Retrieve(2));
+
+    logger.Flush();
+    EXPECT_EQ(expected, logger.Retrieve(1));
+
+    logger.Compact();
+    EXPECT_EQ(expected, logger.Retrieve(1));
+}
+
+TEST_P(SSTableLoggerMergeTest, MergeAfterEraseStartsOver)
+{
+    auto logger = MakeLogger(GetParam());
+    logger.Log(1, 1, {"a"});
+    logger.Erase(1);
+    logger.Merge(1, 2, {"b"});
+    logger.Flush();
+    logger.Merge(1, 3, {"c"});
+
+    const Logger::EntryType expected{5, {"b", "c"}};
+    EXPECT_EQ(expected, logger.Retrieve(1));
+
+    logger.Flush();
+    logger.Compact();
+    EXPECT_EQ(expected, logger.Retrieve(1));
+}
+
+TEST_P(SSTableLoggerMergeTest, SnapshotSeesMergesUpToIt)
+{
+    auto logger = MakeLogger(GetParam());
+    logger.Log(1, 1, {"a"});
+    logger.Merge(1, 2, {"b"});
+    const auto snapshot = logger.GetSnapshot();
+    logger.Merge(1, 3, {"c"});
+    logger.Flush();
+    logger.Compact();
+
+    EXPECT_EQ(std::make_tuple(3, std::vector<std::string>{"a", "b"}),
+              logger.Retrieve(1, snapshot));
+    EXPECT_EQ(std::make_tuple(6, std::vector<std::string>{"a", "b", "c"}), logger.Retrieve(1));
+}
+
+TEST_P(SSTableLoggerMergeTest, WriteBatchMerges)
+{
+    auto logger = MakeLogger(GetParam());
+    Logger::WriteBatch batch;
+    batch.Log(1, 1, {"a"});
+    batch.Merge(1, 2, {"b"});
+    logger.Write(std::move(batch));
+
+    EXPECT_EQ(std::make_tuple(3, std::vector<std::string>{"a", "b"}), logger.Retrieve(1));
+}
+
+TEST_P(SSTableLoggerMergeTest, MergeRenewsExpiringEntry)
+{
+    using namespace std::chrono_literals;
+    const Logger::EntryType expected{101, {"a", "b"}};
+    for (const auto flush : {false, true})
+    {
+        SCOPED_TRACE(flush ? "flushed" : "in memtable");
+        Logger::Clock::time_point now{};
+        auto logger = MakeLoggerWithTtl(GetParam(), 10s, now);
+        logger.Log(1, 100, {"a"});
+        now += 5s;
+        logger.Merge(1, 1, {"b"});
+        if (flush)
+        {
+            logger.Flush();
+        }
+
+        // The entry logged first has expired, but the merge into it has not.
+        now += 6s;
+        EXPECT_EQ(expected, logger.Retrieve(1));
+        logger.Flush();
+        logger.Compact();
+        EXPECT_EQ(expected, logger.Retrieve(1));
+
+        now += 5s;
+        EXPECT_FALSE(logger.Retrieve(1));
+        logger.Compact();
+        EXPECT_EQ(0u, logger.Stats().run_entries);
+    }
+}
+
+TEST_P(SSTableLoggerMergeTest, SnapshotOfExpiredEntryUnderMerge)
+{
+    using namespace std::chrono_literals;
+    Logger::Clock::time_point now{};
+    auto logger = MakeLoggerWithTtl(GetParam(), 10s, now);
+    logger.Log(1, 100, {"a"});
+    const auto snapshot = logger.GetSnapshot();
+    now += 5s;
+    logger.Merge(1, 1, {"b"});
+
+    now += 6s;
+    const Logger::EntryType expected{101, {"a", "b"}};
+    for (const auto compact : {false, true})
+    {
+        if (compact)
+        {
+            logger.Flush();
+            logger.Compact();
+        }
+        EXPECT_FALSE(logger.Retrieve(1, snapshot));
+        EXPECT_EQ(expected, logger.Retrieve(1));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(MergeModes,
+                         SSTableLoggerMergeTest,
+                         testing::Values(Logger::MergeMode::kEager, Logger::MergeMode::kLazy),
+                         [](const testing::TestParamInfo<Logger::MergeMode>& info) {
+                             return info.param == Logger::MergeMode::kEager ? "Eager" : "Lazy";
+                         });
@@ -0,0 +1,177 @@
+#include <data-structures/sstable-logger/partitioned_ss_table_logger.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using Logger = SSTableLogger<int>;
+using PartitionedLogger = PartitionedSSTableLogger<Logger>;
+
+template <typename TLogger>
+std::vector<std::pair<std::int64_t, int>> ScanAll(TLogger& logger,
+                                                  std::int64_t lo,
+                                                  std::int64_t hi)
+{
+    std::vector<std::pair<std::int64_t, int>> entries;
+    logger.Scan(lo, hi, [&entries](std::int64_t key, const Logger::EntryType& entry) {
+        entries.emplace_back(key, std::get<0>(entry));
+        return true;
+    });
+    return entries;
+}
+}  // namespace
+
+TEST(SSTableLoggerScanTest, ScanSeesLatestVersionsAcrossRuns)
+{
+    Logger logger;
+    logger.Log(1, 1);
+    logger.Log(2, 2);
+    logger.Log(3, 3);
+    logger.Flush();
+    logger.Log(2, 22);
+    logger.Erase(3);
+    logger.Log(4, 4);
+
+    EXPECT_EQ(ScanAll(logger, 0, 10),
+              (std::vector<std::pair<std::int64_t, int>>{{1, 1}, {2, 22}, {4, 4}}));
+    EXPECT_EQ(ScanAll(logger, 2, 4), (std::vector<std::pair<std::int64_t, int>>{{2, 22}}));
+    EXPECT_TRUE(ScanAll(logger, 5, 10).empty());
+}
+
+TEST(SSTableLoggerScanTest, ScanStopsWhenVisitorReturnsFalse)
+{
+    Logger logger;
+    for (std::int64_t key = 0; key < 10; ++key) { logger.Log(key, 0); }
+
+    int visited = 0;
+    EXPECT_FALSE(logger.Scan(0, 10, [&visited](std::int64_t, const Logger::EntryType&) {
+        return ++visited < 3;
+    }));
+    EXPECT_EQ(visited, 3);
+}
+
+TEST(PartitionedLoggerTest, RoutesKeysToWindows)
+{
+    PartitionedLogger logger(100);
+    logger.Log(150, 1);
+    logger.Log(420, 2);
+    logger.Log(-1, 3);
+
+    EXPECT_EQ(logger.WindowCount(), 3u);
+    EXPECT_EQ(logger.OldestWindowStart(), -100);
+    EXPECT_EQ(logger.Retrieve(150), std::make_tuple(1));
+    EXPECT_EQ(logger.Retrieve(420), std::make_tuple(2));
+    EXPECT_EQ(logger.Retrieve(-1), std::make_tuple(3));
+    EXPECT_FALSE(logger.Retrieve(250));
+    EXPECT_FALSE(logger.Retrieve(10000));
+
+    logger.Erase(420);
+    EXPECT_FALSE(logger.Retrieve(420));
+}
+
+TEST(PartitionedLoggerTest, ScanCrossesWindowsInKeyOrder)
+{
+    PartitionedLogger logger(10);
+    for (std::int64_t key = 0; key < 100; key += 7) { logger.Log(key, static_cast<int>(key)); }
+    logger.Flush();
+
+    std::vector<std::pair<std::int64_t, int>> expected;
+    for (std::int64_t key = 14; key < 50; key += 7) { expected.emplace_back(key, key); }
+    EXPECT_EQ(ScanAll(logger, 12, 50), expected);
+    EXPECT_TRUE(ScanAll(logger, 200, 300).empty());
+    EXPECT_TRUE(ScanAll(logger, -50, 0).empty());
+}
+
+TEST(PartitionedLoggerTest, DropWindowsBeforeKeepsTheWindowOfKey)
+{
+    PartitionedLogger logger(10);
+    for (std::int64_t key = 0; key < 50; ++key) { logger.Log(key, static_cast<int>(key)); }
+
+    EXPECT_EQ(logger.DropWindowsBefore(25), 2u);
+    EXPECT_EQ(logger.WindowCount(), 3u);
+    EXPECT_EQ(logger.OldestWindowStart(), 20);
+    EXPECT_FALSE(logger.Retrieve(19));
+    EXPECT_EQ(logger.Retrieve(20), std::make_tuple(20));
+    EXPECT_EQ(ScanAll(logger, 0, 22),
+              (std::vector<std::pair<std::int64_t, int>>{{20, 20}, {21, 21}}));
+
+    EXPECT_EQ(logger.DropWindowsBefore(1000), 3u);
+    EXPECT_EQ(logger.WindowCount(), 0u);
+    EXPECT_FALSE(logger.OldestWindowStart());
+}
+
+TEST(PartitionedLoggerTest, DropSkipsEmptyWindowsAtTheFront)
+{
+    PartitionedLogger logger(10);
+    logger.Log(5, 0);
+    logger.Log(45, 0);
+
+    EXPECT_EQ(logger.DropWindowsBefore(10), 1u);
+    EXPECT_EQ(logger.OldestWindowStart(), 40);
+    EXPECT_EQ(logger.WindowCount(), 1u);
+}
+
+TEST(PartitionedLoggerTest, KeysFarApartCreateOnlyTheirWindows)
+{
+    // Millisecond timestamps an hour apart, next to a stray key at the epoch.
+    PartitionedLogger logger(3600);
+    logger.Log(1700000000000, 1);
+    logger.Log(0, 2);
+    logger.Log(1700000003600, 3);
+
+    EXPECT_EQ(logger.WindowCount(), 3u);
+    EXPECT_EQ(logger.OldestWindowStart(), 0);
+    EXPECT_EQ(logger.Retrieve(0), std::make_tuple(2));
+    EXPECT_EQ(logger.Retrieve(1700000000000), std::make_tuple(1));
+    EXPECT_EQ(ScanAll(logger, 0, 1800000000000),
+              (std::vector<std::pair<std::int64_t, int>>{
+                  {0, 2}, {1700000000000, 1}, {1700000003600, 3}}));
+
+    EXPECT_EQ(logger.DropWindowsBefore(1700000000000), 1u);
+    EXPECT_EQ(logger.OldestWindowStart(), 1700000000000 / 3600 * 3600);
+    EXPECT_EQ(logger.WindowCount(), 2u);
+}
+
+TEST(PartitionedLoggerTest, MatchesSingleLogger)
+{
+    std::mt19937 random(5);
+    std::uniform_int_distribution<std::int64_t> keys(-500, 500);
+    std::uniform_int_distribution<int> operations(0, 99);
+
+    PartitionedLogger partitioned(64);
+    Logger single;
+    for (int operation = 0; operation < 5000; ++operation)
+    {
+        const auto key = keys(random);
+        const auto kind = operations(random);
+        if (kind < 75)
+        {
+            partitioned.Log(key, operation);
+            single.Log(key, operation);
+        }
+        else if (kind < 95)
+        {
+            partitioned.Erase(key);
+            single.Erase(key);
+        }
+        else if (kind < 99)
+        {
+            partitioned.Flush();
+            single.Flush();
+        }
+        else
+        {
+            partitioned.Compact();
+            single.Compact();
+        }
+    }
+
+    EXPECT_EQ(ScanAll(partitioned, -600, 600), ScanAll(single, -600, 600));
+    EXPECT_EQ(ScanAll(partitioned, -100, 37), ScanAll(single, -100, 37));
+}
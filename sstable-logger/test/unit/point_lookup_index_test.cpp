@@ -0,0 +1,215 @@
+#include <data-structures/sstable-logger/ss_table_logger.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+std::int64_t MakeKey(std::int64_t key, std::int64_t*)
+{
+    return key;
+}
+
+std::string MakeKey(std::int64_t key, std::string*)
+{
+    // Long enough to be stored on the heap, so that the index owns heap memory.
+    return "a key long enough to leave the small string buffer/" + std::to_string(key);
+}
+}  // namespace
+
+template <typename TLogger>
+class PointLookupIndexTest : public testing::Test
+{
+protected:
+    using Logger = TLogger;
+    using KeyType = typename TLogger::KeyType;
+
+    static KeyType Key(std::int64_t key)
+    {
+        return MakeKey(key, static_cast<KeyType*>(nullptr));
+    }
+
+    static Logger MakeLogger(bool point_lookup_index,
+                             typename Logger::MergeMode merge_mode = Logger::MergeMode::kEager)
+    {
+        typename Logger::Options options;
+        options.merge_operator = [](auto& entry, auto&& operand) {
+            std::get<0>(entry) += std::get<0>(operand);
+        };
+        options.merge_mode = merge_mode;
+        options.point_lookup_index = point_lookup_index;
+        return Logger(options);
+    }
+};
+
+using Loggers = testing::Types<BasicSSTableLogger<std::int64_t, BSTMemtable, int>,
+                               BasicSSTableLogger<std::int64_t, ARTMemtable, int>,
+                               BasicSSTableLogger<std::string, BSTMemtable, int>,
+                               BasicSSTableLogger<std::string, ARTMemtable, int>>;
+TYPED_TEST_SUITE(PointLookupIndexTest, Loggers);
+
+TYPED_TEST(PointLookupIndexTest, RetrieveLatest)
+{
+    auto logger = this->MakeLogger(true);
+    logger.Log(this->Key(1), 1);
+    logger.Log(this->Key(2), 2);
+    logger.Log(this->Key(1), 11);
+    logger.Erase(this->Key(2));
+
+    EXPECT_EQ(logger.Retrieve(this->Key(1)), std::make_tuple(11));
+    EXPECT_FALSE(logger.Retrieve(this->Key(2)));
+    EXPECT_FALSE(logger.Retrieve(this->Key(3)));
+}
+
+TYPED_TEST(PointLookupIndexTest, KeysOnlyInRuns)
+{
+    auto logger = this->MakeLogger(true);
+    logger.Log(this->Key(1), 1);
+    logger.Log(this->Key(2), 2);
+    logger.Flush();
+    logger.Log(this->Key(2), 22);
+
+    // Key 1 is missing from the index, so only the runs are searched.
+    EXPECT_EQ(logger.Retrieve(this->Key(1)), std::make_tuple(1));
+    EXPECT_EQ(logger.Retrieve(this->Key(2)), std::make_tuple(22));
+
+    logger.Flush();
+    logger.Compact();
+    EXPECT_EQ(logger.Retrieve(this->Key(1)), std::make_tuple(1));
+    EXPECT_EQ(logger.Retrieve(this->Key(2)), std::make_tuple(22));
+}
+
+TYPED_TEST(PointLookupIndexTest, SnapshotsOlderThanIndexedVersion)
+{
+    auto logger = this->MakeLogger(true);
+    logger.Log(this->Key(1), 1);
+    const auto first = logger.GetSnapshot();
+    logger.Log(this->Key(1), 2);
+    const auto second = logger.GetSnapshot();
+    logger.Erase(this->Key(1));
+
+    EXPECT_EQ(logger.Retrieve(this->Key(1), first), std::make_tuple(1));
+    EXPECT_EQ(logger.Retrieve(this->Key(1), second), std::make_tuple(2));
+    EXPECT_FALSE(logger.Retrieve(this->Key(1)));
+}
+
+TYPED_TEST(PointLookupIndexTest, LazyMergeOperands)
+{
+    auto logger = this->MakeLogger(true, TestFixture::Logger::MergeMode::kLazy);
+    logger.Log(this->Key(1), 1);
+    logger.Flush();
+    logger.Merge(this->Key(1), 2);
+    logger.Merge(this->Key(1), 3);
+
+    // The newest version is a merge operand, which needs the older versions.
+    EXPECT_EQ(logger.Retrieve(this->Key(1)), std::make_tuple(6));
+}
+
+TYPED_TEST(PointLookupIndexTest, IndexCountsTowardsMemtableBytes)
+{
+    auto indexed = this->MakeLogger(true);
+    auto unindexed = this->MakeLogger(false);
+    for (std::int64_t key = 0; key < 100; ++key)
+    {
+        indexed.Log(this->Key(key), 0);
+        unindexed.Log(this->Key(key), 0);
+    }
+    EXPECT_GT(indexed.MemtableBytes(), unindexed.MemtableBytes());
+
+    indexed.Flush();
+    EXPECT_EQ(indexed.MemtableBytes(), 0);
+}
+
+TYPED_TEST(PointLookupIndexTest, MatchesUnindexedLogger)
+{
+    using Logger = typename TestFixture::Logger;
+    for (const auto merge_mode : {Logger::MergeMode::kEager, Logger::MergeMode::kLazy})
+    {
+        SCOPED_TRACE(merge_mode == Logger::MergeMode::kEager ? "eager" : "lazy");
+        auto indexed = this->MakeLogger(true, merge_mode);
+        auto unindexed = this->MakeLogger(false, merge_mode);
+        std::vector<typename Logger::Snapshot> snapshots;
+        std::mt19937 random(42);
+        std::uniform_int_distribution<std::int64_t> key(0, 63);
+        std::uniform_int_distribution<int> operation(0, 99);
+
+        for (int step = 0; step < 2000; ++step)
+        {
+            const auto k = this->Key(key(random));
+            const auto chosen = operation(random);
+            if (chosen < 60)
+            {
+                indexed.Log(k, step);
+                unindexed.Log(k, step);
+            }
+            else if (chosen < 75)
+            {
+                indexed.Erase(k);
+                unindexed.Erase(k);
+            }
+            else if (chosen < 90)
+            {
+                indexed.Merge(k, step);
+                unindexed.Merge(k, step);
+            }
+            else if (chosen < 94)
+            {
+                snapshots.push_back(indexed.GetSnapshot());
+                unindexed.GetSnapshot();
+            }
+            else if (chosen < 98)
+            {
+                indexed.Flush();
+                unindexed.Flush();
+            }
+            else
+            {
+                indexed.Compact();
+                unindexed.Compact();
+            }
+
+            ASSERT_EQ(indexed.Retrieve(k), unindexed.Retrieve(k)) << step;
+            if (!snapshots.empty())
+            {
+                const auto& snapshot = snapshots[static_cast<std::size_t>(step) % snapshots.size()];
+                ASSERT_EQ(indexed.Retrieve(k, snapshot), unindexed.Retrieve(k, snapshot)) << step;
+            }
+        }
+    }
+}
+
+namespace
+{
+/**
+ * Totally ordered key without a std::hash specialization.
+ */
+struct UnhashableKey
+{
+    int value;
+
+    friend auto operator<=>(const UnhashableKey&, const UnhashableKey&) = default;
+};
+}  // namespace
+
+TEST(PointLookupIndexOptionTest, RejectedForUnhashableKeys)
+{
+    using Logger = BasicSSTableLogger<UnhashableKey, BSTMemtable, int>;
+    static_assert(!Hashable<UnhashableKey>);
+
+    Logger::Options options;
+    options.point_lookup_index = true;
+    EXPECT_THROW(Logger{options}, std::invalid_argument);
+
+    options.point_lookup_index = false;
+    Logger logger(options);
+    logger.Log(UnhashableKey{1}, 1);
+    EXPECT_EQ(logger.Retrieve(UnhashableKey{1}), std::make_tuple(1));
+}
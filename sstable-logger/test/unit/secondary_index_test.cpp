@@ -0,0 +1,169 @@
+#include <data-structures/sstable-logger/indexed_ss_table_logger.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+/// Entries of a request log: status code, path and latency in milliseconds.
+using Logger = IndexedSSTableLogger<SSTableLogger<int, std::string, int>, 0, 2>;
+
+std::vector<std::int64_t> Keys(
+    const std::vector<std::pair<Logger::KeyType, Logger::EntryType>>& found)
+{
+    std::vector<std::int64_t> keys;
+    for (const auto& [key, entry] : found) { keys.push_back(key); }
+    return keys;
+}
+}  // namespace
+
+TEST(SecondaryIndexTest, EqualityLookup)
+{
+    Logger logger;
+    logger.Log(1, 200, "/", 5);
+    logger.Log(2, 404, "/missing", 1);
+    logger.Log(3, 200, "/about", 7);
+
+    const auto found = logger.LookupEqual<0>(200);
+    EXPECT_EQ(Keys(found), (std::vector<std::int64_t>{1, 3}));
+    EXPECT_EQ(found[1].second, std::make_tuple(200, std::string("/about"), 7));
+    EXPECT_EQ(Keys(logger.LookupEqual<0>(404)), (std::vector<std::int64_t>{2}));
+    EXPECT_TRUE(logger.LookupEqual<0>(500).empty());
+}
+
+TEST(SecondaryIndexTest, RangeLookupIsOrderedByField)
+{
+    Logger logger;
+    logger.Log(1, 200, "/", 30);
+    logger.Log(2, 200, "/", 10);
+    logger.Log(3, 200, "/", 20);
+    logger.Log(4, 200, "/", 40);
+
+    EXPECT_EQ(Keys(logger.LookupRange<2>(10, 40)), (std::vector<std::int64_t>{2, 3, 1}));
+    EXPECT_TRUE(logger.LookupRange<2>(41, 100).empty());
+}
+
+TEST(SecondaryIndexTest, OverwrittenAndErasedEntriesAreNotFound)
+{
+    Logger logger;
+    logger.Log(1, 500, "/", 5);
+    logger.Log(2, 500, "/", 5);
+    logger.Log(3, 500, "/", 5);
+    logger.Log(1, 200, "/", 5);
+    logger.Erase(2);
+    logger.Flush();
+
+    EXPECT_EQ(Keys(logger.LookupEqual<0>(500)), (std::vector<std::int64_t>{3}));
+    EXPECT_EQ(Keys(logger.LookupEqual<0>(200)), (std::vector<std::int64_t>{1}));
+    // The lookup dropped the stale pairs it met.
+    EXPECT_EQ(logger.IndexSize<0>(), 2u);
+    // The index on latency still holds a stale pair for every overwrite and erasure.
+    EXPECT_EQ(logger.IndexSize<2>(), 3u);
+
+    logger.Compact();
+    EXPECT_EQ(logger.IndexSize<2>(), 2u);
+}
+
+TEST(SecondaryIndexTest, ReloggingTheSameFieldKeepsOnePair)
+{
+    Logger logger;
+    logger.Log(1, 200, "/", 5);
+    logger.Log(1, 200, "/", 5);
+    EXPECT_EQ(logger.IndexSize<0>(), 1u);
+    EXPECT_EQ(Keys(logger.LookupEqual<0>(200)), (std::vector<std::int64_t>{1}));
+}
+
+TEST(SecondaryIndexTest, ExpiredEntriesAreNotFound)
+{
+    auto now = SSTableLogger<int, std::string, int>::Clock::time_point();
+    Logger::Options options;
+    options.ttl = std::chrono::seconds(10);
+    options.clock = [&now] { return now; };
+    Logger logger(std::move(options));
+
+    logger.Log(1, 200, "/", 5);
+    now += std::chrono::seconds(5);
+    logger.Log(2, 200, "/", 5);
+    now += std::chrono::seconds(6);
+
+    EXPECT_EQ(Keys(logger.LookupEqual<0>(200)), (std::vector<std::int64_t>{2}));
+}
+
+TEST(SecondaryIndexTest, MergesAndBatchesAreIndexed)
+{
+    Logger::Options options;
+    options.merge_operator = [](Logger::EntryType& existing, Logger::EntryType&& update) {
+        std::get<2>(existing) += std::get<2>(update);
+    };
+    options.merge_mode = Logger::LoggerType::MergeMode::kLazy;
+    Logger logger(std::move(options));
+
+    logger.Log(1, 200, "/", 5);
+    logger.Merge(1, 200, "/", 10);
+
+    Logger::WriteBatch batch;
+    batch.Log(2, 404, "/missing", 1);
+    batch.Merge(2, 404, "/missing", 2);
+    batch.Log(3, 200, "/", 1);
+    batch.Erase(3);
+    logger.Write(std::move(batch));
+
+    EXPECT_EQ(Keys(logger.LookupEqual<2>(15)), (std::vector<std::int64_t>{1}));
+    EXPECT_EQ(Keys(logger.LookupEqual<2>(3)), (std::vector<std::int64_t>{2}));
+    EXPECT_TRUE(logger.LookupEqual<2>(5).empty());
+    EXPECT_EQ(Keys(logger.LookupEqual<0>(200)), (std::vector<std::int64_t>{1}));
+}
+
+TEST(SecondaryIndexTest, MatchesScanOfAllKeys)
+{
+    std::mt19937 random(3);
+    std::uniform_int_distribution<std::int64_t> keys(0, 300);
+    std::uniform_int_distribution<int> statuses(0, 9);
+    std::uniform_int_distribution<int> operations(0, 99);
+
+    Logger logger;
+    std::map<std::int64_t, int> expected;
+    for (int operation = 0; operation < 5000; ++operation)
+    {
+        const auto key = keys(random);
+        const auto kind = operations(random);
+        if (kind < 75)
+        {
+            const auto status = statuses(random);
+            logger.Log(key, status, "/", operation);
+            expected[key] = status;
+        }
+        else if (kind < 95)
+        {
+            logger.Erase(key);
+            expected.erase(key);
+        }
+        else if (kind < 99)
+        {
+            logger.Flush();
+        }
+        else
+        {
+            logger.Compact();
+        }
+    }
+
+    for (int status = 0; status < 10; ++status)
+    {
+        std::vector<std::int64_t> matching;
+        for (const auto& [key, logged_status] : expected)
+        {
+            if (logged_status == status)
+            {
+                matching.push_back(key);
+            }
+        }
+        EXPECT_EQ(Keys(logger.LookupEqual<0>(status)), matching) << status;
+    }
+}
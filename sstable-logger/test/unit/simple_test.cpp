@@ -35,3 +35,21 @@ TEST(SSTableLoggerTest, RetrieveUnknownReturnsNull)
     logger.Log(1, 22, "twenty two");
     EXPECT_FALSE(logger.Retrieve(0));
 }
+
+TEST(SSTableLoggerTest, LogIncreasingAndOutOfOrderKeys)
+{
+    SSTableLogger<int> logger;
+    for (auto key = 0; key < 100; key += 2) { logger.Log(key, key); }
+    for (auto key = 99; key > 0; key -= 2) { logger.Log(key, key); }
+    logger.Log(50, 500);
+    logger.Log(200, 200);
+
+    for (auto key = 0; key < 100; ++key)
+    {
+        const auto result = logger.Retrieve(key);
+        ASSERT_TRUE(result) << "key " << key;
+        EXPECT_EQ(key == 50 ? 500 : key, std::get<0>(*result));
+    }
+    EXPECT_TRUE(logger.Retrieve(200));
+    EXPECT_FALSE(logger.Retrieve(100));
+}
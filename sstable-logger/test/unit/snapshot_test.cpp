@@ -0,0 +1,104 @@
+#include <data-structures/sstable-logger/ss_table_logger.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace
+{
+using Logger = SSTableLogger<int, std::string>;
+}  // namespace
+
+TEST(SSTableLoggerSnapshotTest, SnapshotDoesNotSeeLaterWrites)
+{
+    Logger logger;
+    logger.Log(1, 11, "eleven");
+    const auto snapshot = logger.GetSnapshot();
+
+    logger.Log(1, 111, "one hundred eleven");
+    logger.Log(2, 22, "twenty two");
+    logger.Erase(3);
+
+    EXPECT_EQ(std::make_tuple(11, std::string("eleven")), logger.Retrieve(1, snapshot));
+    EXPECT_FALSE(logger.Retrieve(2, snapshot));
+    EXPECT_EQ(std::make_tuple(111, std::string("one hundred eleven")), logger.Retrieve(1));
+    EXPECT_TRUE(logger.Retrieve(2));
+}
+
+TEST(SSTableLoggerSnapshotTest, SnapshotSeesEntryErasedLater)
+{
+    Logger logger;
+    logger.Log(1, 11, "eleven");
+    const auto snapshot = logger.GetSnapshot();
+    logger.Erase(1);
+
+    EXPECT_TRUE(logger.Retrieve(1, snapshot));
+    EXPECT_FALSE(logger.Retrieve(1));
+}
+
+TEST(SSTableLoggerSnapshotTest, SequenceNumbersIncrease)
+{
+    Logger logger;
+    const auto empty = logger.GetSnapshot();
+    logger.Log(1, 11, "eleven");
+    const auto after_one = logger.GetSnapshot();
+    logger.Erase(1);
+    const auto after_two = logger.GetSnapshot();
+
+    EXPECT_LT(empty.Sequence(), after_one.Sequence());
+    EXPECT_LT(after_one.Sequence(), after_two.Sequence());
+}
+
+TEST(SSTableLoggerSnapshotTest, SnapshotVersionsSurviveFlushAndCompact)
+{
+    Logger logger;
+    logger.Log(1, 11, "eleven");
+    logger.Log(2, 22, "twenty two");
+    const auto snapshot = logger.GetSnapshot();
+    logger.Log(1, 111, "one hundred eleven");
+    logger.Flush();
+    logger.Erase(2);
+    logger.Flush();
+    logger.Compact();
+
+    EXPECT_EQ(std::make_tuple(11, std::string("eleven")), logger.Retrieve(1, snapshot));
+    EXPECT_EQ(std::make_tuple(22, std::string("twenty two")), logger.Retrieve(2, snapshot));
+    EXPECT_EQ(std::make_tuple(111, std::string("one hundred eleven")), logger.Retrieve(1));
+    EXPECT_FALSE(logger.Retrieve(2));
+}
+
+TEST(SSTableLoggerSnapshotTest, ReleasedSnapshotVersionsAreDropped)
+{
+    Logger logger;
+    logger.Log(1, 11, "eleven");
+    const auto snapshot = logger.GetSnapshot();
+    logger.Log(1, 111, "one hundred eleven");
+
+    logger.ReleaseSnapshot(snapshot);
+    logger.Flush();
+
+    // The version the released snapshot used to see is gone.
+    EXPECT_FALSE(logger.Retrieve(1, snapshot));
+    EXPECT_EQ(std::make_tuple(111, std::string("one hundred eleven")), logger.Retrieve(1));
+}
+
+TEST(SSTableLoggerSnapshotTest, WriteBatchAppliesAllWrites)
+{
+    Logger logger;
+    logger.Log(3, 33, "thirty three");
+    const auto before = logger.GetSnapshot();
+
+    Logger::WriteBatch batch;
+    batch.Log(1, 11, "eleven");
+    batch.Log(2, 22, "twenty two");
+    batch.Erase(3);
+    logger.Write(std::move(batch));
+
+    EXPECT_FALSE(logger.Retrieve(1, before));
+    EXPECT_FALSE(logger.Retrieve(2, before));
+    EXPECT_TRUE(logger.Retrieve(3, before));
+
+    EXPECT_TRUE(logger.Retrieve(1));
+    EXPECT_TRUE(logger.Retrieve(2));
+    EXPECT_FALSE(logger.Retrieve(3));
+}
@@ -0,0 +1,84 @@
+#include <data-structures/sstable-logger/indexed_ss_table_logger.hpp>
+#include <data-structures/sstable-logger/ss_table_logger.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+static_assert(std::is_empty_v<SSTableLoggerCounters<false>>);
+static_assert(std::is_move_assignable_v<IndexedSSTableLogger<SSTableLogger<int, int>, 0>>);
+
+TEST(SSTableLoggerStatsTest, CountsWritesAndMemtable)
+{
+    SSTableLogger<int> logger;
+    logger.Log(1, 1);
+    logger.Log(2, 2);
+    logger.Erase(1);
+
+    auto stats = logger.Stats();
+    EXPECT_EQ(stats.append.calls, 3u);
+    EXPECT_EQ(stats.values_logged, 2u);
+    EXPECT_EQ(stats.tombstones_logged, 1u);
+    EXPECT_EQ(stats.merge_operands_logged, 0u);
+    EXPECT_EQ(stats.memtable_entries, 3u);
+    EXPECT_GT(stats.memtable_bytes, 0u);
+    EXPECT_EQ(stats.run_count, 0u);
+
+    logger.Flush();
+    stats = logger.Stats();
+    EXPECT_EQ(stats.memtable_entries, 0u);
+    EXPECT_EQ(stats.memtable_bytes, 0u);
+    EXPECT_EQ(stats.run_count, 1u);
+    EXPECT_EQ(stats.run_entries, 2u);
+}
+
+TEST(SSTableLoggerStatsTest, CountsLookupPaths)
+{
+    SSTableLogger<int> logger;
+    logger.Log(1, 1);
+    logger.Flush();
+    logger.Log(2, 2);
+    logger.Flush();
+    logger.Log(3, 3);
+
+    logger.Retrieve(3);
+    logger.Retrieve(2);
+    logger.Retrieve(1);
+    logger.Retrieve(4);
+
+    const auto stats = logger.Stats();
+    EXPECT_EQ(stats.retrieve.calls, 4u);
+    EXPECT_EQ(stats.retrieve.comparisons, 3u);
+    EXPECT_EQ(stats.retrieves_resolved_in_memtable, 1u);
+    EXPECT_EQ(stats.retrieves_resolved_in_runs, 2u);
+    EXPECT_EQ(stats.retrieves_searched_everything, 1u);
+    EXPECT_EQ(stats.runs_searched, 1u + 2 + 2);
+}
+
+TEST(SSTableLoggerStatsTest, MovedLoggerKeepsStats)
+{
+    SSTableLogger<int> logger;
+    logger.Log(1, 1);
+    logger.Log(2, 2);
+
+    auto moved = std::move(logger);
+    EXPECT_EQ(moved.Stats().append.calls, 2u);
+    EXPECT_EQ(moved.Stats().values_logged, 2u);
+
+    logger = SSTableLogger<int>();
+    logger.Log(3, 3);
+    EXPECT_EQ(logger.Stats().append.calls, 1u);
+}
+
+TEST(SSTableLoggerStatsTest, Json)
+{
+    SSTableLogger<int> logger;
+    logger.Log(1, 1);
+    const auto json = ToJson(logger.Stats());
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_NE(json.find("\"append\":{\"calls\":1,"), std::string::npos);
+    EXPECT_NE(json.find("\"values_logged\":1,"), std::string::npos);
+    EXPECT_NE(json.find("\"runs_searched\":0}"), std::string::npos);
+}
@@ -0,0 +1,108 @@
+#include <data-structures/sstable-logger/tailing_ss_table_logger.hpp>
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+using Logger = TailingSSTableLogger<SSTableLogger<int, std::string>>;
+using Event = Logger::Event;
+
+std::vector<Event> Drain(Logger::Subscription& subscription)
+{
+    std::vector<Event> events;
+    subscription->TryReceive(events, 1000);
+    return events;
+}
+
+std::vector<int> Keys(const std::vector<Event>& events)
+{
+    std::vector<int> keys;
+    for (const auto& event : events) { keys.push_back(static_cast<int>(event.key)); }
+    return keys;
+}
+}  // namespace
+
+TEST(TailingSSTableLoggerTest, StreamsWritesInSubscribedRange)
+{
+    Logger logger;
+    logger.Log(1, 0, "before subscribing");
+
+    auto low = logger.Subscribe(0, 10, 16);
+    auto high = logger.Subscribe(5, 100, 16);
+    logger.Log(2, 2, "two");
+    logger.Log(7, 7, "seven");
+    logger.Erase(2);
+    logger.Log(50, 50, "fifty");
+    logger.Log(100, 100, "out of range");
+
+    const auto low_events = Drain(low);
+    EXPECT_EQ(Keys(low_events), (std::vector<int>{2, 7, 2}));
+    EXPECT_EQ(low_events[0].entry, std::make_tuple(2, std::string("two")));
+    EXPECT_EQ(low_events[2].entry, std::nullopt);
+    EXPECT_EQ(Keys(Drain(high)), (std::vector<int>{7, 50}));
+}
+
+TEST(TailingSSTableLoggerTest, PublishesMergedEntriesAndBatches)
+{
+    Logger::Options options;
+    options.merge_operator = [](Logger::EntryType& existing, Logger::EntryType&& update) {
+        std::get<0>(existing) += std::get<0>(update);
+    };
+    Logger logger(std::move(options));
+    auto subscription = logger.Subscribe(0, 10, 16);
+
+    logger.Log(1, 1, "a");
+    logger.Merge(1, 2, "");
+
+    Logger::WriteBatch batch;
+    batch.Log(2, 20, "b");
+    batch.Merge(2, 5, "");
+    batch.Erase(3);
+    logger.Write(std::move(batch));
+
+    const auto events = Drain(subscription);
+    EXPECT_EQ(Keys(events), (std::vector<int>{1, 1, 2, 2, 3}));
+    EXPECT_EQ(events[1].entry, std::make_tuple(3, std::string("a")));
+    EXPECT_EQ(events[2].entry, std::make_tuple(20, std::string("b")));
+    EXPECT_EQ(events[3].entry, std::make_tuple(25, std::string("b")));
+    EXPECT_EQ(events[4].entry, std::nullopt);
+}
+
+TEST(TailingSSTableLoggerTest, ClosingUnsubscribes)
+{
+    Logger logger;
+    auto subscription = logger.Subscribe(0, 10, 16);
+    EXPECT_EQ(logger.SubscriptionCount(), 1u);
+
+    subscription->Close();
+    logger.Log(1, 1, "a");
+    EXPECT_EQ(logger.SubscriptionCount(), 0u);
+    EXPECT_TRUE(Drain(subscription).empty());
+}
+
+TEST(TailingSSTableLoggerTest, ConsumerOnAnotherThread)
+{
+    constexpr auto kEntries = 5000;
+    auto logger = std::make_unique<Logger>();
+    auto subscription = logger->Subscribe(0, kEntries, 8, Backpressure::kBlock);
+
+    std::vector<int> received;
+    std::thread consumer([&] {
+        std::vector<Event> events;
+        while (subscription->Receive(events, 64) > 0) {}
+        received = Keys(events);
+    });
+    for (auto key = 0; key < kEntries; ++key) { logger->Log(key, key, ""); }
+    // Destroying the logger closes the subscription, which stops the consumer once it is drained.
+    logger.reset();
+    consumer.join();
+
+    ASSERT_EQ(received.size(), static_cast<std::size_t>(kEntries));
+    for (auto key = 0; key < kEntries; ++key) { EXPECT_EQ(received[key], key); }
+}